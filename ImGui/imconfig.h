@@ -98,6 +98,10 @@
 // The only purpose of this define is if you want force compilation of the stb_truetype backend ALONG with the FreeType backend.
 //#define IMGUI_ENABLE_STB_TRUETYPE
 
+//---- Size in bytes of the per-font cache of parsed glyph outlines used by the stb_truetype loader (default 512 KB, 0 to disable).
+// Outlines are shared by all baked sizes of a font, so baking a new size only needs to rasterize glyphs.
+//#define IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE   (512 * 1024)
+
 //---- Define constructor and implicit cast operators to convert back<>forth between your math types and ImVec2/ImVec4.
 // This will be inlined as part of ImVec2 and ImVec4 class declarations.
 /*
@@ -118,6 +122,11 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 16 bytes ImDrawVert (default is 20 bytes) where texture coordinates are stored as 16-bit normalized values.
+// Reduces vertex memory and copy bandwidth by 20%. UV are clamped to [0..1] (UV outside this range, e.g. for a repeating texture, are not supported).
+// Your renderer backend will need to support it: read 'ImVec2 uv = vtx.uv;' instead of vtx.uv.x/vtx.uv.y (or upload 'uv' as USHORT2N normalized attribute).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -1318,6 +1318,7 @@ static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
 static void             UpdateSettings();
+static void             UpdateMemoryCompaction(float memory_compact_start_time);
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1538,8 +1539,13 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsCopyContentsWithCtrlC = false;
+    ConfigWindowsOcclusionCulling = false;
+    ConfigWindowsOcclusionSkipItems = false;
+    ConfigDrawListCulling = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigMemoryCompactMaxBytesPerFrame = 0;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -3898,15 +3904,19 @@ void ImGui::RenderMouseCursor(ImVec2 base_pos, float base_scale, ImGuiMouseCurso
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         // We scale cursor with current viewport/monitor, however Windows 10 for its own hardware cursor seems to be using a different scale factor.
+        // Shared atlas: read UV and texture together while holding the lock, as another thread may repack the atlas.
         ImVec2 offset, size, uv[4];
-        if (!ImFontAtlasGetMouseCursorTexData(font_atlas, mouse_cursor, &offset, &size, &uv[0], &uv[2]))
+        ImFontAtlasSharedLock(font_atlas);
+        const bool has_cursor_data = ImFontAtlasGetMouseCursorTexData(font_atlas, mouse_cursor, &offset, &size, &uv[0], &uv[2]);
+        ImTextureRef tex_ref = font_atlas->TexRef;
+        ImFontAtlasSharedUnlock(font_atlas);
+        if (!has_cursor_data)
             continue;
         const ImVec2 pos = base_pos - offset;
         const float scale = base_scale;
         if (!viewport->GetMainRect().Overlaps(ImRect(pos, pos + ImVec2(size.x + 2, size.y + 2) * scale)))
             continue;
         ImDrawList* draw_list = GetForegroundDrawList(viewport);
-        ImTextureRef tex_ref = font_atlas->TexRef;
         draw_list->PushTexture(tex_ref);
         draw_list->AddImage(tex_ref, pos + ImVec2(1, 0) * scale, pos + (ImVec2(1, 0) + size) * scale, uv[2], uv[3], col_shadow);
         draw_list->AddImage(tex_ref, pos + ImVec2(2, 0) * scale, pos + (ImVec2(2, 0) + size) * scale, uv[2], uv[3], col_shadow);
@@ -4003,6 +4013,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     Initialized = false;
     Font = NULL;
     FontBaked = NULL;
+    LabelSizeCacheGeneration = 0;
     FontSize = FontSizeBase = FontBakedScale = CurrentDpiScale = 0.0f;
     FontRasterizerDensity = 1.0f;
     IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
@@ -4014,6 +4025,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     WithinEndChildID = 0;
     WithinFrameScope = WithinFrameScopeWithImplicitWindow = false;
     GcCompactAll = false;
+    GcWindowsCursor = 0;
     TestEngineHookItems = false;
     TestEngine = NULL;
     memset(ContextName, 0, sizeof(ContextName));
@@ -4144,6 +4156,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     MouseStationaryTimer = 0.0f;
 
     InputTextPasswordFontBackupFlags = ImFontFlags_None;
+    InputTextPasswordFontBackupFont = NULL;
+    InputTextPasswordFontBackupFontBaked = NULL;
     TempInputId = 0;
     memset(&DataTypeZeroValue, 0, sizeof(DataTypeZeroValue));
     BeginMenuDepth = BeginComboDepth = 0;
@@ -4311,6 +4325,7 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsOccluderRects.clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4347,6 +4362,7 @@ void ImGui::Shutdown()
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
+    g.ComboFilterState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
@@ -4468,32 +4484,199 @@ void ImGui::GcCompactTransientMiscBuffers()
         atlas->CompactCache();
 }
 
+static int GcCalcDrawListBuffersSize(const ImDrawList* draw_list)
+{
+    return draw_list->VtxBuffer.Capacity * (int)sizeof(ImDrawVert) + draw_list->IdxBuffer.Capacity * (int)sizeof(ImDrawIdx) + draw_list->CmdBuffer.Capacity * (int)sizeof(ImDrawCmd);
+}
+
+// Reallocate a vector to a smaller capacity (ImVector<> never shrinks on its own). Return number of bytes freed.
+template<typename T>
+static int GcTrimVectorCapacity(ImVector<T>& v, int new_capacity)
+{
+    new_capacity = ImMax(new_capacity, v.Size);
+    if (new_capacity >= v.Capacity)
+        return 0;
+    const int freed_bytes = (v.Capacity - new_capacity) * (int)sizeof(T);
+    T* new_data = (new_capacity > 0) ? (T*)IM_ALLOC((size_t)new_capacity * sizeof(T)) : NULL;
+    if (v.Size > 0)
+        memcpy(new_data, v.Data, (size_t)v.Size * sizeof(T));
+    IM_FREE(v.Data);
+    v.Data = new_data;
+    v.Capacity = new_capacity;
+    return freed_bytes;
+}
+
 // Free up/compact internal window buffers, we can use this when a window becomes unused.
 // Not freed:
 // - ImGuiWindow, ImGuiWindowSettings, Name, StateStorage, ColumnsStorage (may hold useful data)
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    ImGuiContext& g = *GImGui;
+    g.GcStats.CompactedBytes += (ImU64)GcCalcDrawListBuffersSize(window->DrawList);
+    g.GcStats.CompactCount++;
     window->MemoryCompacted = true;
-    window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
-    window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
+    window->MemoryTrimmed = false;
+    // Prefer the recent high-water mark over capacity, which may have been inflated by a single large frame.
+    window->MemoryDrawListIdxCapacity = (window->MemoryDrawListIdxHighWater > 0) ? window->MemoryDrawListIdxHighWater : window->DrawList->IdxBuffer.Capacity;
+    window->MemoryDrawListVtxCapacity = (window->MemoryDrawListVtxHighWater > 0) ? window->MemoryDrawListVtxHighWater : window->DrawList->VtxBuffer.Capacity;
+    window->MemoryDrawListIdxTrimmedCapacity = window->MemoryDrawListVtxTrimmedCapacity = 0;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
+    window->LabelSizeCache.ClearFreeMemory();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
 {
     // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
     // The other buffers tends to amortize much faster.
+    ImGuiContext& g = *GImGui;
     window->MemoryCompacted = false;
     window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
     window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
+    window->MemoryDrawListIdxTrimmedCapacity = window->DrawList->IdxBuffer.Capacity;
+    window->MemoryDrawListVtxTrimmedCapacity = window->DrawList->VtxBuffer.Capacity;
+    g.GcStats.RegrowthBytes += (ImU64)window->MemoryDrawListIdxCapacity * sizeof(ImDrawIdx) + (ImU64)window->MemoryDrawListVtxCapacity * sizeof(ImDrawVert);
+    g.GcStats.AwakeCount++;
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+// Trim draw list buffers toward the recent high-water mark of the window (+ some headroom).
+// Unlike GcCompactTransientWindowBuffers() this keeps what the window recently needed, so toggling it doesn't cause allocation spikes.
+// Return number of bytes freed or moved, so callers can limit the amount of work done every frame.
+int ImGui::GcTrimTransientWindowBuffers(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawList* draw_list = window->DrawList;
+    const int vtx_target = window->MemoryDrawListVtxHighWater + window->MemoryDrawListVtxHighWater / 8;
+    const int idx_target = window->MemoryDrawListIdxHighWater + window->MemoryDrawListIdxHighWater / 8;
+    int freed_bytes = 0;
+    int moved_bytes = 0;
+    if (draw_list->VtxBuffer.Capacity > vtx_target + vtx_target / 2) // Don't bother for less than a regular ImVector<> growth step
+    {
+        moved_bytes += draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+        freed_bytes += GcTrimVectorCapacity(draw_list->VtxBuffer, vtx_target);
+    }
+    if (draw_list->IdxBuffer.Capacity > idx_target + idx_target / 2)
+    {
+        moved_bytes += draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        freed_bytes += GcTrimVectorCapacity(draw_list->IdxBuffer, idx_target);
+    }
+    if (freed_bytes > 0)
+    {
+        g.GcStats.TrimmedBytes += (ImU64)freed_bytes;
+        g.GcStats.TrimCount++;
+        window->MemoryDrawListVtxTrimmedCapacity = draw_list->VtxBuffer.Capacity;
+        window->MemoryDrawListIdxTrimmedCapacity = draw_list->IdxBuffer.Capacity;
+    }
+
+    // Start a new measurement period
+    window->MemoryDrawListVtxHighWater = draw_list->VtxBuffer.Size;
+    window->MemoryDrawListIdxHighWater = draw_list->IdxBuffer.Size;
+    window->MemoryLastTrimTime = (float)g.Time;
+    return freed_bytes + moved_bytes;
+}
+
+// Garbage collect transient buffers of unused windows, and trim buffers of used windows toward their recent high-water mark.
+// - Windows unused for io.ConfigMemoryCompactTimer are freed, or only trimmed while under io.ConfigMemoryCompactBudget.
+// - Buffers of used windows are only trimmed with a budget (or on explicit GC request): with io.ConfigMemoryCompactBudget == 0 they are left untouched as before.
+// - When over io.ConfigMemoryCompactBudget, least recently used windows are freed first.
+// - Work is spread over multiple frames when exceeding io.ConfigMemoryCompactMaxBytesPerFrame.
+static void ImGui::UpdateMemoryCompaction(float memory_compact_start_time)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    ImGuiGcStats& stats = g.GcStats;
+    const int bytes_per_frame_max = (g.GcCompactAll || io.ConfigMemoryCompactMaxBytesPerFrame <= 0) ? INT_MAX : io.ConfigMemoryCompactMaxBytesPerFrame;
+    int bytes_processed = 0;
+    stats.DeferredCount = 0;
+
+    // Update high-water marks and re-growth cost. Draw lists still hold contents of last frame at this point.
+    ImU64 retained_bytes = 0;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        ImDrawList* draw_list = window->DrawList;
+        if (window->WasActive)
+        {
+            window->MemoryDrawListVtxHighWater = ImMax(window->MemoryDrawListVtxHighWater, draw_list->VtxBuffer.Size);
+            window->MemoryDrawListIdxHighWater = ImMax(window->MemoryDrawListIdxHighWater, draw_list->IdxBuffer.Size);
+            if (window->MemoryDrawListVtxTrimmedCapacity > 0 && draw_list->VtxBuffer.Capacity > window->MemoryDrawListVtxTrimmedCapacity)
+            {
+                stats.RegrowthBytes += (ImU64)(draw_list->VtxBuffer.Capacity - window->MemoryDrawListVtxTrimmedCapacity) * sizeof(ImDrawVert);
+                window->MemoryDrawListVtxTrimmedCapacity = draw_list->VtxBuffer.Capacity;
+            }
+            if (window->MemoryDrawListIdxTrimmedCapacity > 0 && draw_list->IdxBuffer.Capacity > window->MemoryDrawListIdxTrimmedCapacity)
+            {
+                stats.RegrowthBytes += (ImU64)(draw_list->IdxBuffer.Capacity - window->MemoryDrawListIdxTrimmedCapacity) * sizeof(ImDrawIdx);
+                window->MemoryDrawListIdxTrimmedCapacity = draw_list->IdxBuffer.Capacity;
+            }
+        }
+        else if (!window->MemoryCompacted)
+        {
+            retained_bytes += (ImU64)GcCalcDrawListBuffersSize(draw_list);
+        }
+    }
+
+    // Over budget: free least recently used windows first
+    if (io.ConfigMemoryCompactBudget > 0)
+        while (retained_bytes > (ImU64)io.ConfigMemoryCompactBudget)
+        {
+            ImGuiWindow* lru_window = NULL;
+            for (ImGuiWindow* window : g.Windows)
+                if (!window->WasActive && !window->MemoryCompacted && (lru_window == NULL || window->LastTimeActive < lru_window->LastTimeActive))
+                    lru_window = window;
+            if (lru_window == NULL)
+                break;
+            if (bytes_processed >= bytes_per_frame_max)
+            {
+                stats.DeferredCount++;
+                break;
+            }
+            const int window_bytes = GcCalcDrawListBuffersSize(lru_window->DrawList);
+            GcCompactTransientWindowBuffers(lru_window);
+            retained_bytes -= (ImU64)window_bytes;
+            bytes_processed += window_bytes;
+        }
+
+    // Timer based compaction. Resume where we stopped last frame, so all windows get processed eventually.
+    const int windows_count = g.Windows.Size;
+    if (g.GcWindowsCursor >= windows_count)
+        g.GcWindowsCursor = 0;
+    int cursor_next = 0;
+    for (int n = 0; n < windows_count; n++)
+    {
+        const int window_idx = (g.GcWindowsCursor + n) % windows_count;
+        ImGuiWindow* window = g.Windows[window_idx];
+        const bool want_compact = !window->WasActive && !window->MemoryCompacted && !window->MemoryTrimmed && window->LastTimeActive < memory_compact_start_time;
+        const bool want_trim = window->WasActive && window->MemoryLastTrimTime < memory_compact_start_time && ((io.ConfigMemoryCompactBudget > 0 && io.ConfigMemoryCompactTimer >= 0.0f) || g.GcCompactAll);
+        if (!want_compact && !want_trim)
+            continue;
+        if (bytes_processed >= bytes_per_frame_max)
+        {
+            if (stats.DeferredCount++ == 0)
+                cursor_next = window_idx;
+            continue;
+        }
+        if (want_compact && (io.ConfigMemoryCompactBudget <= 0 || g.GcCompactAll))
+        {
+            bytes_processed += GcCalcDrawListBuffersSize(window->DrawList);
+            GcCompactTransientWindowBuffers(window);
+        }
+        else
+        {
+            bytes_processed += GcTrimTransientWindowBuffers(window);
+            if (want_compact)
+                window->MemoryTrimmed = true;
+        }
+    }
+    g.GcWindowsCursor = cursor_next;
+    stats.RetainedBytes = retained_bytes;
+    stats.LastFrameProcessedBytes = bytes_processed;
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -5020,7 +5203,7 @@ static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t draw
     if (viewport->BgFgDrawListsLastFrame[drawlist_no] != g.FrameCount)
     {
         draw_list->_ResetForNewFrame();
-        draw_list->PushTexture(g.IO.Fonts->TexRef);
+        draw_list->PushTexture(ImFontAtlasGetTexRef(g.IO.Fonts, &g.DrawListSharedData));
         draw_list->PushClipRect(viewport->Pos, viewport->Pos + viewport->Size, false);
         viewport->BgFgDrawListsLastFrame[drawlist_no] = g.FrameCount;
     }
@@ -5176,6 +5359,23 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
     return (window->Active) && (!window->Hidden);
 }
 
+// With io.ConfigWindowsOcclusionSkipItems, windows that were fully covered during last Render() don't need to submit their contents.
+// We keep submitting when the window is focused/interacted with, as those would generally bring it to front.
+static bool IsWindowOccludedForSkipItems(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.IO.ConfigWindowsOcclusionCulling || !g.IO.ConfigWindowsOcclusionSkipItems || g.LogEnabled)
+        return false;
+    ImGuiWindow* root_window = window->RootWindow;
+    if (!root_window->RenderOccluded || window->Appearing)
+        return false;
+    if (g.NavWindow && g.NavWindow->RootWindow == root_window)
+        return false;
+    if (g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == root_window)
+        return false;
+    return true;
+}
+
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags(const ImVec2& mouse_pos)
 {
@@ -5278,9 +5478,18 @@ static void ImGui::UpdateTexturesNewFrame()
             // Otherwise, calling ImGui::CreateContext() without parameter will create an atlas owned by the context.
             // (2) If you have multiple font atlases, make sure the 'atlas->RendererHasTextures' as specified in the ImFontAtlasUpdateNewFrame() call matches for that.
             // (3) If you have multiple imgui contexts, they also need to have a matching value for ImGuiBackendFlags_RendererHasTextures.
-            IM_ASSERT(atlas->Builder != NULL && atlas->Builder->FrameCount != -1);
-            IM_ASSERT(atlas->RendererHasTextures == has_textures);
+            // (4) If the atlas is shared between threads (see ImFontAtlas::LockFn), the context owning it needs to call NewFrame() once before other contexts do: synchronize your threads startup accordingly.
+            ImFontAtlasSharedLock(atlas);
+            const bool atlas_updated = atlas->Builder != NULL && atlas->Builder->FrameCount != -1;
+            const bool atlas_has_textures = atlas->RendererHasTextures;
+            ImFontAtlasSharedUnlock(atlas);
+            IM_ASSERT(atlas_updated && "Font atlas was never updated. If it is shared between threads, its owner context must call NewFrame() before other contexts do.");
+            IM_ASSERT(atlas_has_textures == has_textures);
+            IM_UNUSED(atlas_updated);
+            IM_UNUSED(atlas_has_textures);
         }
+        if (atlas->LockFn != NULL)
+            ImFontAtlasSharedNewFrame(atlas, &g.DrawListSharedData);
     }
 }
 
@@ -5290,6 +5499,13 @@ static void ImGui::UpdateTexturesEndFrame()
     ImGuiContext& g = *GImGui;
     g.PlatformIO.Textures.resize(0);
     for (ImFontAtlas* atlas : g.FontAtlases)
+    {
+        // Atlas shared across threads: each context has its own copies of textures.
+        if (atlas->SharedData != NULL)
+        {
+            ImFontAtlasSharedEndFrame(atlas, &g.DrawListSharedData, &g.PlatformIO.Textures);
+            continue;
+        }
         for (ImTextureData* tex : atlas->TexList)
         {
             // We provide this information so backends can decide whether to destroy textures.
@@ -5297,6 +5513,7 @@ static void ImGui::UpdateTexturesEndFrame()
             tex->RefCount = (unsigned short)atlas->RefCount;
             g.PlatformIO.Textures.push_back(tex);
         }
+    }
     for (ImTextureData* tex : g.UserTextures)
         g.PlatformIO.Textures.push_back(tex);
 }
@@ -5321,6 +5538,8 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.ConfigDrawListCulling)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_CullOffscreen;
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
 }
 
@@ -5495,12 +5714,11 @@ void ImGui::NewFrame()
         window->WriteAccessed = false;
         window->BeginCountPreviousFrame = window->BeginCount;
         window->BeginCount = 0;
-
-        // Garbage collect transient buffers of recently unused windows
-        if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
-            GcCompactTransientWindowBuffers(window);
     }
 
+    // Garbage collect transient buffers of recently unused windows
+    UpdateMemoryCompaction(memory_compact_start_time);
+
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
     // (currently needs to be done after the WasActive=Active loop and FindHoveredWindowEx uses ->Active)
@@ -5643,6 +5861,108 @@ static inline void AddRootWindowToDrawData(ImGuiWindow* window)
     AddWindowToDrawData(window, GetWindowDisplayLayer(window));
 }
 
+// Return true if everything a draw list would output is hidden behind one of the occluder rectangles.
+// We first test the command clip rectangle, and only if that fails we compute the bounding box of its vertices.
+// Window decorations are using the viewport as clip rectangle so the vertices test is what generally matters for them.
+static bool IsDrawListOccluded(ImDrawList* draw_list, const ImRect& viewport_rect, const ImVector<ImRect>& occluders)
+{
+    if (draw_list->_Splitter._Count > 1)
+        draw_list->ChannelsMerge(); // Same as AddWindowToDrawData(), done earlier so we can see all commands.
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback != NULL)
+            return false; // Callbacks may have side effects: always output them.
+        if (cmd.ElemCount == 0)
+            continue;
+        ImRect visible_rect(cmd.ClipRect);
+        visible_rect.ClipWithFull(viewport_rect);
+        bool covered = false;
+        for (const ImRect& occluder : occluders)
+            if (occluder.Contains(visible_rect))
+            {
+                covered = true;
+                break;
+            }
+        if (covered)
+            continue;
+
+        ImRect vtx_bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+        const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            vtx_bb.Add(vtx[idx[n]].pos);
+        visible_rect.ClipWithFull(vtx_bb);
+        if (visible_rect.Min.x >= visible_rect.Max.x || visible_rect.Min.y >= visible_rect.Max.y)
+            continue;
+        for (const ImRect& occluder : occluders)
+            if (occluder.Contains(visible_rect))
+            {
+                covered = true;
+                break;
+            }
+        if (!covered)
+            return false;
+    }
+    return true;
+}
+
+static bool IsWindowOccluded(ImGuiWindow* window, const ImRect& viewport_rect, const ImVector<ImRect>& occluders)
+{
+    if (!IsDrawListOccluded(window->DrawList, viewport_rect, occluders))
+        return false;
+    for (ImGuiWindow* child : window->DC.ChildWindows)
+        if (IsWindowActiveAndVisible(child) && !IsWindowOccluded(child, viewport_rect, occluders))
+            return false;
+    return true;
+}
+
+// Test a root window against accumulated occluders, then register its own opaque area for windows below it.
+static void UpdateWindowOcclusion(ImGuiWindow* window, const ImRect& viewport_rect, ImVector<ImRect>& occluders)
+{
+    if (occluders.Size > 0 && IsWindowOccluded(window, viewport_rect, occluders))
+    {
+        window->RenderOccluded = true;
+        return;
+    }
+    ImRect r = window->OpaqueRect;
+    if (r.Min.x >= r.Max.x || r.Min.y >= r.Max.y)
+        return;
+    if (window->WindowRounding > 0.0f)
+    {
+        // Rounded corners are not opaque, and edges have an anti-aliased fringe: register two conservative inner rectangles.
+        const float rounding = window->WindowRounding;
+        r.Expand(-1.0f);
+        occluders.push_back(ImRect(r.Min.x + rounding, r.Min.y, r.Max.x - rounding, r.Max.y));
+        occluders.push_back(ImRect(r.Min.x, r.Min.y + rounding, r.Max.x, r.Max.y - rounding));
+    }
+    else
+    {
+        occluders.push_back(r);
+    }
+}
+
+// Visit root windows in reverse display order (tooltip layer first, top-most windows first within a layer)
+// and mark those entirely covered by opaque windows above them. Called after RenderDimmedBackgrounds() so dimming is accounted for.
+static void UpdateWindowsOcclusion(ImGuiWindow* windows_to_render_top_most[2])
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImRect>& occluders = g.WindowsOccluderRects;
+    occluders.resize(0);
+    const ImRect viewport_rect = g.Viewports[0]->GetMainRect();
+    for (int layer = 1; layer >= 0; layer--)
+    {
+        for (int n = 1; n >= 0; n--)
+            if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n]) && GetWindowDisplayLayer(windows_to_render_top_most[n]) == layer)
+                UpdateWindowOcclusion(windows_to_render_top_most[n], viewport_rect, occluders);
+        for (int window_n = g.Windows.Size - 1; window_n >= 0; window_n--)
+        {
+            ImGuiWindow* window = g.Windows[window_n];
+            if (IsWindowActiveAndVisible(window) && (window->Flags & ImGuiWindowFlags_ChildWindow) == 0 && window != windows_to_render_top_most[0] && window != windows_to_render_top_most[1] && GetWindowDisplayLayer(window) == layer)
+                UpdateWindowOcclusion(window, viewport_rect, occluders);
+        }
+    }
+}
+
 static void FlattenDrawDataIntoSingleLayer(ImDrawDataBuilder* builder)
 {
     int n = builder->Layers[0]->Size;
@@ -5876,8 +6196,10 @@ void ImGui::EndFrame()
     UpdateTexturesEndFrame();
 
     // Unlock font atlas
+    // (a shared atlas is never locked as it requires ImGuiBackendFlags_RendererHasTextures, don't write the flag other threads read while loading glyphs)
     for (ImFontAtlas* atlas : g.FontAtlases)
-        atlas->Locked = false;
+        if (atlas->SharedData == NULL)
+            atlas->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5903,6 +6225,7 @@ void ImGui::Render()
     g.FrameCountRendered = g.FrameCount;
 
     g.IO.MetricsRenderWindows = 0;
+    g.IO.MetricsRenderWindowsOccluded = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
 
     // Add background ImDrawList (for each active viewport)
@@ -5920,14 +6243,23 @@ void ImGui::Render()
     ImGuiWindow* windows_to_render_top_most[2];
     windows_to_render_top_most[0] = (g.NavWindowingTarget && !(g.NavWindowingTarget->Flags & ImGuiWindowFlags_NoBringToFrontOnFocus)) ? g.NavWindowingTarget->RootWindow : NULL;
     windows_to_render_top_most[1] = (g.NavWindowingTarget ? g.NavWindowingListWindow : NULL);
+    for (ImGuiWindow* window : g.Windows)
+        window->RenderOccluded = false;
+    if (g.IO.ConfigWindowsOcclusionCulling)
+        UpdateWindowsOcclusion(windows_to_render_top_most);
     for (ImGuiWindow* window : g.Windows)
     {
         IM_MSVC_WARNING_SUPPRESS(6011); // Static Analysis false positive "warning C6011: Dereferencing NULL pointer 'window'"
         if (IsWindowActiveAndVisible(window) && (window->Flags & ImGuiWindowFlags_ChildWindow) == 0 && window != windows_to_render_top_most[0] && window != windows_to_render_top_most[1])
-            AddRootWindowToDrawData(window);
+        {
+            if (window->RenderOccluded)
+                g.IO.MetricsRenderWindowsOccluded++;
+            else
+                AddRootWindowToDrawData(window);
+        }
     }
     for (int n = 0; n < IM_ARRAYSIZE(windows_to_render_top_most); n++)
-        if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
+        if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n]) && !windows_to_render_top_most[n]->RenderOccluded) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(windows_to_render_top_most[n]);
 
     // Draw software mouse cursor if requested by io.MouseDrawCursor flag
@@ -5935,7 +6267,7 @@ void ImGui::Render()
         RenderMouseCursor(g.IO.MousePos, g.Style.MouseCursorScale, g.MouseCursor, IM_COL32_WHITE, IM_COL32_BLACK, IM_COL32(0, 0, 0, 48));
 
     // Setup ImDrawData structures for end-user
-    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = g.IO.MetricsRenderVerticesCulled = 0;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -5948,7 +6280,13 @@ void ImGui::Render()
         ImDrawData* draw_data = &viewport->DrawDataP;
         IM_ASSERT(draw_data->CmdLists.Size == draw_data->CmdListsCount);
         for (ImDrawList* draw_list : draw_data->CmdLists)
+        {
             draw_list->_PopUnusedDrawCmd();
+            g.IO.MetricsRenderVerticesCulled += draw_list->_CulledVtxCount;
+        }
+        for (ImFontAtlas* atlas : g.FontAtlases)
+            if (atlas->SharedData != NULL)
+                ImFontAtlasSharedUpdateDrawDataTextures(atlas, &g.DrawListSharedData, draw_data);
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
@@ -6543,6 +6881,8 @@ static void CalcWindowContentSizes(ImGuiWindow* window, ImVec2* content_size_cur
         preserve_old_content_sizes = true;
     else if (window->Hidden && window->HiddenFramesCannotSkipItems == 0 && window->HiddenFramesCanSkipItems > 0)
         preserve_old_content_sizes = true;
+    else if (window->SkipItemsOccluded)
+        preserve_old_content_sizes = true;
     if (preserve_old_content_sizes)
     {
         *content_size_current = window->ContentSize;
@@ -6977,6 +7317,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
     // As we highlight the title bar when want_focus is set, multiple reappearing windows will have their title bar highlighted on their reappearing frame.
     const float window_rounding = window->WindowRounding;
     const float window_border_size = window->WindowBorderSize;
+    window->OpaqueRect = ImRect();
     if (window->Collapsed)
     {
         // Title bar only
@@ -7002,6 +7343,8 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
             if (override_alpha)
                 bg_col = (bg_col & ~IM_COL32_A_MASK) | (IM_F32_TO_INT8_SAT(alpha) << IM_COL32_A_SHIFT);
             window->DrawList->AddRectFilled(window->Pos + ImVec2(0, window->TitleBarHeight), window->Pos + window->Size, bg_col, window_rounding, (flags & ImGuiWindowFlags_NoTitleBar) ? 0 : ImDrawFlags_RoundCornersBottom);
+            if ((bg_col & IM_COL32_A_MASK) == IM_COL32_A_MASK)
+                window->OpaqueRect = ImRect(window->Pos + ImVec2(0, window->TitleBarHeight), window->Pos + window->Size);
         }
 
         // Title bar
@@ -7009,6 +7352,8 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
         {
             ImU32 title_bar_col = GetColorU32(title_bar_is_highlight ? ImGuiCol_TitleBgActive : ImGuiCol_TitleBg);
             window->DrawList->AddRectFilled(title_bar_rect.Min, title_bar_rect.Max, title_bar_col, window_rounding, ImDrawFlags_RoundCornersTop);
+            if ((title_bar_col & IM_COL32_A_MASK) == IM_COL32_A_MASK && window->OpaqueRect.GetWidth() > 0.0f && window->OpaqueRect.Min.y == title_bar_rect.Max.y)
+                window->OpaqueRect.Min.y = title_bar_rect.Min.y;
         }
 
         // Menu bar
@@ -7162,30 +7507,88 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
     }
 }
 
+// [EXPERIMENTAL] Used by UpdateWindowSkipRefresh() for ImGuiWindowRefreshFlags_RefreshOnInput
+static bool IsWindowReceivingInputsForRefresh(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* root_window = window->RootWindow;
+    if (g.ActiveIdWindow && (g.ActiveIdWindow->RootWindow == root_window || ImGui::IsWindowWithinBeginStackOf(g.ActiveIdWindow->RootWindow, window)))
+        return true;
+    for (const ImGuiPopupData& popup_data : g.OpenPopupStack)
+    {
+        if (popup_data.Window ? ImGui::IsWindowWithinBeginStackOf(popup_data.Window, window) : (popup_data.RestoreNavWindow && popup_data.RestoreNavWindow->RootWindow == root_window))
+            return true;
+    }
+
+    const bool is_focused = (g.NavWindow && g.NavWindow->RootWindow == root_window);
+    if (is_focused != window->RefreshFocused)
+        return true;
+    if (is_focused)
+    {
+        if (g.NavAnyRequest || g.IO.InputQueueCharacters.Size > 0)
+            return true;
+        for (const ImGuiInputEvent& e : g.InputEventsTrail)
+            if (e.Type == ImGuiInputEventType_Key || e.Type == ImGuiInputEventType_Text)
+                return true;
+    }
+    return false;
+}
+
 // [EXPERIMENTAL] Called by Begin(). NextWindowData is valid at this point.
 // This is designed as a toy/test-bed for
+// Layout is frozen on skipped frames: SetNextWindowXXX() requests have already been applied at this point, and any resulting change requires a refresh.
 void ImGui::UpdateWindowSkipRefresh(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
     window->SkipRefresh = false;
-    if ((g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasRefreshPolicy) == 0)
-        return;
-    if (g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_TryToAvoidRefresh)
+    if ((g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasRefreshPolicy) == 0 || (g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_TryToAvoidRefresh) == 0)
     {
-        // FIXME-IDLE: Tests for e.g. mouse clicks or keyboard while focused.
-        if (window->Appearing) // If currently appearing
-            return;
-        if (window->Hidden) // If was hidden (previous frame)
-            return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnHover) && g.HoveredWindow)
-            if (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window))
-                return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow)
-            if (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window))
-                return;
-        window->DrawList = NULL;
-        window->SkipRefresh = true;
+        window->RefreshLastTime = g.Time;
+        window->RefreshAfterInput = false;
+        return;
+    }
+
+    // Interactions: refresh, then refresh once more after them
+    const ImGuiWindowRefreshFlags refresh_flags = g.NextWindowData.RefreshFlagsVal;
+    bool refresh_for_input = false;
+    if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnHover) && g.HoveredWindow)
+        if (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window))
+            refresh_for_input = true;
+    if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow)
+        if (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window))
+            refresh_for_input = true;
+    if ((refresh_flags & ImGuiWindowRefreshFlags_RefreshOnInput) && !refresh_for_input)
+        refresh_for_input = IsWindowReceivingInputsForRefresh(window);
+    bool refresh = refresh_for_input || window->RefreshAfterInput;
+    window->RefreshAfterInput = refresh_for_input;
+
+    // Appearing, was hidden (previous frame), pending layout, moved or resized
+    // (font texture: use the copy of our context, as a shared atlas may be repacked by another thread at any time)
+    ImTextureData* font_tex = ImFontAtlasGetTexRef(g.IO.Fonts, &g.DrawListSharedData)._TexData;
+    if (!refresh)
+        refresh = window->Appearing || window->Hidden || window->WantCollapseToggle
+            || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesCanSkipItems > 0
+            || window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX
+            || window->Pos != window->RefreshPos || window->SizeFull != window->RefreshSizeFull
+            || (window->SetWindowPosVal.x != FLT_MAX && ImTrunc(window->SetWindowPosVal - window->Size * window->SetWindowPosPivot) != window->Pos)
+            || (font_tex && font_tex->UniqueID != window->RefreshTexUniqueID);
+
+    // Refresh rate: refresh when crossing a period boundary. Boundaries are offset per window so that windows sharing a rate don't all refresh on the same frame.
+    const float refresh_rate = g.NextWindowData.RefreshRateVal;
+    if (!refresh && refresh_rate > 0.0f)
+    {
+        const double phase = (window->ID & 0xFF) / 256.0;
+        refresh = (ImS64)(g.Time * refresh_rate + phase) != (ImS64)(window->RefreshLastTime * refresh_rate + phase);
+    }
+
+    if (refresh)
+    {
+        window->RefreshLastTime = g.Time;
+        window->RefreshFocused = (g.NavWindow && g.NavWindow->RootWindow == window->RootWindow);
+        return;
     }
+    window->DrawList = NULL;
+    window->SkipRefresh = true;
 }
 
 static void SetWindowActiveForSkipRefresh(ImGuiWindow* window)
@@ -7386,10 +7789,15 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->IDStack.resize(1);
         window->DrawList->_ResetForNewFrame();
         window->DC.CurrentTableIdx = -1;
+        if (flags & ImGuiWindowFlags_CacheLabelSizes)
+            window->LabelSizeCache.NewFrame();
+        else
+            window->LabelSizeCache.ClearFreeMemory();
 
         // Restore buffer capacity when woken from a compacted state, to avoid
         if (window->MemoryCompacted)
             GcAwakeTransientWindowBuffers(window);
+        window->MemoryTrimmed = false;
 
         // Update stored window name when it changes (which can _only_ happen with the "###" operator, so the ID would stay unchanged).
         // The title bar always display the 'name' parameter, so we only update the string storage if it needs to be visible to the end-user elsewhere.
@@ -7736,7 +8144,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Setup draw list and outer clipping rectangle
         IM_ASSERT(window->DrawList->CmdBuffer.Size == 1 && window->DrawList->CmdBuffer[0].ElemCount == 0);
-        window->DrawList->PushTexture(g.Font->ContainerAtlas->TexRef);
+        window->DrawList->PushTexture(ImFontAtlasGetTexRef(g.Font->ContainerAtlas, &g.DrawListSharedData));
         PushClipRect(host_rect.Min, host_rect.Max, false);
 
         // Child windows can render their decoration (bg color, border, scrollbars, etc.) within their parent to save a draw call (since 1.71)
@@ -7957,10 +8365,16 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Update the SkipItems flag, used to early out of all items functions (no layout required)
         bool skip_items = false;
-        if (window->Collapsed || !window->Active || hidden_regular)
-            if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
+        bool skip_items_occluded = false;
+        if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
+        {
+            if (window->Collapsed || !window->Active || hidden_regular)
                 skip_items = true;
+            else if (IsWindowOccludedForSkipItems(window))
+                skip_items = skip_items_occluded = true;
+        }
         window->SkipItems = skip_items;
+        window->SkipItemsOccluded = skip_items_occluded;
     }
     else if (first_begin_of_the_frame)
     {
@@ -8014,6 +8428,13 @@ void ImGui::End()
         IM_ASSERT(window->DrawList == NULL);
         window->DrawList = &window->DrawListInst;
     }
+    else
+    {
+        window->RefreshPos = window->Pos;
+        window->RefreshSizeFull = window->SizeFull;
+        ImTextureData* font_tex = ImFontAtlasGetTexRef(g.IO.Fonts, &g.DrawListSharedData)._TexData;
+        window->RefreshTexUniqueID = font_tex ? font_tex->UniqueID : 0;
+    }
 
     // Stop logging
     if (g.LogWindow == window) // FIXME: add more options for scope of logging
@@ -8476,6 +8897,21 @@ void ImGui::SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags flags)
     ImGuiContext& g = *GImGui;
     g.NextWindowData.HasFlags |= ImGuiNextWindowDataFlags_HasRefreshPolicy;
     g.NextWindowData.RefreshFlagsVal = flags;
+    g.NextWindowData.RefreshRateVal = 0.0f;
+}
+
+// [BETA] Skipped frames reuse the previous frame ImDrawList as-is, so their cost is roughly that of a Begin()/End() pair without contents.
+void ImGui::SetNextWindowRefreshRate(float refresh_rate)
+{
+    ImGuiContext& g = *GImGui;
+    if (refresh_rate <= 0.0f)
+    {
+        g.NextWindowData.HasFlags &= ~ImGuiNextWindowDataFlags_HasRefreshPolicy;
+        return;
+    }
+    g.NextWindowData.HasFlags |= ImGuiNextWindowDataFlags_HasRefreshPolicy;
+    g.NextWindowData.RefreshFlagsVal = ImGuiWindowRefreshFlags_TryToAvoidRefresh | ImGuiWindowRefreshFlags_RefreshOnHover | ImGuiWindowRefreshFlags_RefreshOnInput;
+    g.NextWindowData.RefreshRateVal = refresh_rate;
 }
 
 ImDrawList* ImGui::GetWindowDrawList()
@@ -8750,18 +9186,22 @@ void ImGui::RegisterFontAtlas(ImFontAtlas* atlas)
     ImGuiContext& g = *GImGui;
     if (g.FontAtlases.Size == 0)
         IM_ASSERT(atlas == g.IO.Fonts);
+    ImFontAtlasSharedLock(atlas);
     atlas->RefCount++;
     g.FontAtlases.push_back(atlas);
     ImFontAtlasAddDrawListSharedData(atlas, &g.DrawListSharedData);
+    ImFontAtlasSharedUnlock(atlas);
 }
 
 void ImGui::UnregisterFontAtlas(ImFontAtlas* atlas)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(atlas->RefCount > 0);
+    ImFontAtlasSharedLock(atlas);
     ImFontAtlasRemoveDrawListSharedData(atlas, &g.DrawListSharedData);
     g.FontAtlases.find_erase(atlas);
     atlas->RefCount--;
+    ImFontAtlasSharedUnlock(atlas);
 }
 
 // Use ImDrawList::_SetTexture(), making our shared g.FontStack[] authoritative against window-local ImDrawList.
@@ -8790,7 +9230,7 @@ void ImGui::SetCurrentFont(ImFont* font, float font_size_before_scaling, float f
         g.DrawListSharedData.Font = font;
         ImFontAtlasUpdateDrawListsSharedData(atlas);
         if (g.CurrentWindow != NULL)
-            g.CurrentWindow->DrawList->_SetTexture(atlas->TexRef);
+            g.CurrentWindow->DrawList->_SetTexture(ImFontAtlasGetTexRef(atlas, &g.DrawListSharedData));
     }
 }
 
@@ -8835,10 +9275,17 @@ void ImGui::UpdateCurrentFontSize(float restore_font_size_after_scaling)
     // - We may support it better later and remove this rounding.
     final_size = GetRoundedFontSize(final_size);
     final_size = ImClamp(final_size, 1.0f, IMGUI_FONT_SIZE_MAX);
+    // Shared font atlas: other threads may use the same ImFont at another density, so we pass ours instead of writing it into the font.
+    float density = -1.0f;
     if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures))
-        g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
+    {
+        if (g.Font->ContainerAtlas->SharedData != NULL)
+            density = g.FontRasterizerDensity;
+        else
+            g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
+    }
     g.FontSize = final_size;
-    g.FontBaked = (g.Font != NULL && window != NULL) ? g.Font->GetFontBaked(final_size) : NULL;
+    g.FontBaked = (g.Font != NULL && window != NULL) ? g.Font->GetFontBaked(final_size, density) : NULL;
     g.FontBakedScale = (g.Font != NULL && window != NULL) ? (g.FontSize / g.FontBaked->Size) : 0.0f;
     g.DrawListSharedData.FontSize = g.FontSize;
     g.DrawListSharedData.FontScale = g.FontBakedScale;
@@ -11326,6 +11773,58 @@ ImVec2 ImGui::CalcItemSize(ImVec2 size, float default_w, float default_h)
     return size;
 }
 
+// Equivalent to CalcTextSize(label, NULL, true), reusing last frame value when the window uses ImGuiWindowFlags_CacheLabelSizes.
+// - 'id' must have been computed from 'label' (e.g. window->GetID(label)): this is what guarantees that a different text is a different entry.
+// - Labels using the "###" operator are always measured, as their ID doesn't depend on the visible text.
+// - We look a few entries ahead of the read cursor to resynchronize after items have been removed. A new item is a miss and doesn't move the cursor.
+ImVec2 ImGui::CalcItemLabelSize(ImGuiID id, const char* label)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (!(window->Flags & ImGuiWindowFlags_CacheLabelSizes))
+        return CalcTextSize(label, NULL, true);
+
+    const char* label_end = FindRenderedTextEnd(label);
+    if (label_end[0] == '#' && label_end[1] == '#' && label_end[2] == '#')
+        return CalcTextSize(label, label_end, false);
+
+    ImGuiLabelSizeCache& cache = window->LabelSizeCache;
+    if (cache.Generation != g.LabelSizeCacheGeneration)
+    {
+        cache.Entries.resize(0);
+        cache.EntriesPrev.resize(0);
+        cache.ReadCursor = 0;
+        cache.Generation = g.LabelSizeCacheGeneration;
+    }
+
+    const int LOOKAHEAD = 8;
+    const ImGuiLabelSizeCacheEntry* entry = NULL;
+    for (int n = cache.ReadCursor, n_end = ImMin(cache.ReadCursor + LOOKAHEAD, cache.EntriesPrev.Size); n < n_end; n++)
+        if (cache.EntriesPrev.Data[n].ID == id)
+        {
+            entry = &cache.EntriesPrev.Data[n];
+            cache.ReadCursor = n + 1;
+            break;
+        }
+
+    ImGuiLabelSizeCacheEntry new_entry;
+    new_entry.ID = id;
+    new_entry.FontSize = g.FontSize;
+    new_entry.FontBaked = g.FontBaked;
+    if (entry != NULL && entry->FontBaked == new_entry.FontBaked && entry->FontSize == new_entry.FontSize)
+    {
+        new_entry.Size = entry->Size;
+        cache.Hits++;
+    }
+    else
+    {
+        new_entry.Size = CalcTextSize(label, label_end, false);
+        cache.Misses++;
+    }
+    cache.Entries.push_back(new_entry);
+    return new_entry.Size;
+}
+
 float ImGui::GetTextLineHeight()
 {
     ImGuiContext& g = *GImGui;
@@ -12849,8 +13348,20 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
 
     // Compute distance between boxes
     // FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
+    const ImGuiDir move_dir = g.NavMoveDir;
     float dbx = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
     float dby = NavScoreItemDistInterval(ImLerp(cand.Min.y, cand.Max.y, 0.2f), ImLerp(cand.Min.y, cand.Max.y, 0.8f), ImLerp(curr.Min.y, curr.Max.y, 0.2f), ImLerp(curr.Min.y, curr.Max.y, 0.8f)); // Scale down on Y to keep using box-distance for vertically touching items
+
+    // Early out for the bulk of candidates in large windows, without changing results:
+    // - a box on the wrong side of 'curr' along the move axis can't be in the move quadrant nor pass the axial check below.
+    // - dist_box >= |dby|, so a box further than current best along Y can't beat it (axial check only runs while there is no best).
+#if !IMGUI_DEBUG_NAV_SCORING
+    if ((move_dir == ImGuiDir_Left && dbx > 0.0f) || (move_dir == ImGuiDir_Right && dbx < 0.0f) || (move_dir == ImGuiDir_Up && dby > 0.0f) || (move_dir == ImGuiDir_Down && dby < 0.0f))
+        return false;
+    if (ImFabs(dby) > result->DistBox)
+        return false;
+#endif
+
     if (dby != 0.0f && dbx != 0.0f)
         dbx = (dbx / 1000.0f) + ((dbx > 0.0f) ? +1.0f : -1.0f);
     float dist_box = ImFabs(dbx) + ImFabs(dby);
@@ -12888,7 +13399,6 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
         quadrant = (g.LastItemData.ID < g.NavId) ? ImGuiDir_Left : ImGuiDir_Right;
     }
 
-    const ImGuiDir move_dir = g.NavMoveDir;
 #if IMGUI_DEBUG_NAV_SCORING
     char buf[200];
     if (g.IO.KeyCtrl) // Hold CTRL to preview score in matching quadrant. CTRL+Arrow to rotate.
@@ -15972,15 +16482,18 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     }
 
     SeparatorText("Font Atlas");
+    ImFontAtlasSharedLock(atlas); // Held until end of function: other threads may modify the atlas
     if (Button("Compact"))
         atlas->CompactCache();
     SameLine();
     if (Button("Grow"))
         ImFontAtlasTextureGrow(atlas);
     SameLine();
+    BeginDisabled(atlas->SharedData != NULL);
     if (Button("Clear All"))
         ImFontAtlasBuildClear(atlas);
-    SetItemTooltip("Destroy cache and custom rectangles.");
+    EndDisabled();
+    SetItemTooltip(atlas->SharedData ? "Not available while atlas is shared across threads." : "Destroy cache and custom rectangles.");
 
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
@@ -15993,6 +16506,8 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    if (ImFontAtlasSharedData* shared = atlas->SharedData)
+        Text("Shared across threads: %d contexts, %d allocations waiting to be freed", shared->Users.Size, shared->Retired.Size);
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16032,6 +16547,7 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
             SetNextItemOpen(true, ImGuiCond_Once);
         DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid) ? &highlight_r : NULL);
     }
+    ImFontAtlasSharedUnlock(atlas);
 }
 
 void ImGui::DebugNodeTexture(ImTextureData* tex, int int_id, const ImFontAtlasRect* highlight_rect)
@@ -16096,6 +16612,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
+    if (io.ConfigWindowsOcclusionCulling)
+        Text("%d occluded windows", io.MetricsRenderWindowsOccluded);
+    if (io.ConfigDrawListCulling || io.MetricsRenderVerticesCulled > 0)
+        Text("%d culled vertices", io.MetricsRenderVerticesCulled);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -16442,6 +16962,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        const ImGuiGcStats& gc_stats = g.GcStats;
+        Text("Windows buffers: %d compacted (%.1f KB), %d trimmed (%.1f KB), %d awakened", gc_stats.CompactCount, (double)gc_stats.CompactedBytes / 1024.0, gc_stats.TrimCount, (double)gc_stats.TrimmedBytes / 1024.0, gc_stats.AwakeCount);
+        Text("Re-growth after compaction: %.1f KB. Retained by inactive windows: %.1f KB", (double)gc_stats.RegrowthBytes / 1024.0, (double)gc_stats.RetainedBytes / 1024.0);
+        Text("Last frame: %d bytes processed, %d windows deferred", gc_stats.LastFrameProcessedBytes, gc_stats.DeferredCount);
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -16567,6 +17091,13 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("HoverItemDelayId: 0x%08X, Timer: %.2f, ClearTimer: %.2f", g.HoverItemDelayId, g.HoverItemDelayTimer, g.HoverItemDelayClearTimer);
         Text("DragDrop: %d, SourceId = 0x%08X, Payload \"%s\" (%d bytes)", g.DragDropActive, g.DragDropPayload.SourceId, g.DragDropPayload.DataType, g.DragDropPayload.DataSize);
         DebugLocateItemOnHover(g.DragDropPayload.SourceId);
+        int label_size_cache_hits = 0, label_size_cache_misses = 0;
+        for (ImGuiWindow* window : g.Windows)
+        {
+            label_size_cache_hits += window->LabelSizeCache.HitsPrev;
+            label_size_cache_misses += window->LabelSizeCache.MissesPrev;
+        }
+        Text("LabelSizeCache: %d hits, %d misses last frame, Generation: %d", label_size_cache_hits, label_size_cache_misses, g.LabelSizeCacheGeneration);
         Unindent();
 
         Text("NAV,FOCUS");
@@ -16752,6 +17283,8 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
 
     if (window && !window->WasActive)
         TextDisabled("Warning: owning Window is inactive. This DrawList is not being rendered!");
+    if (draw_list->_CulledVtxCount > 0)
+        TextDisabled("%d vertices culled outside of clip rectangles.", draw_list->_CulledVtxCount);
 
     for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.Data; pcmd < draw_list->CmdBuffer.Data + cmd_count; pcmd++)
     {
@@ -16802,9 +17335,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImVec2 uv = v.uv;
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -16993,6 +17527,12 @@ void ImGui::DebugNodeFont(ImFont* font)
             const int surface_sqrt = (int)ImSqrt((float)baked->MetricsTotalSurface);
             Text("Ascent: %f, Descent: %f, Ascent-Descent: %f", baked->Ascent, baked->Descent, baked->Ascent - baked->Descent);
             Text("Texture Area: about %d px ~%dx%d px", baked->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+            int index_pages_count = 0;
+            for (ImFontBakedIndexPage* page : baked->IndexPages)
+                index_pages_count += (page != NULL) ? 1 : 0;
+            const size_t index_bytes = index_pages_count * sizeof(ImFontBakedIndexPage) + baked->IndexPages.Size * sizeof(ImFontBakedIndexPage*);
+            const size_t index_dense_bytes = baked->IndexPages.Size * IM_FONTBAKED_INDEX_PAGE_SIZE * (sizeof(float) + sizeof(ImU16));
+            Text("Index: %d/%d pages of %d codepoints, %.1f KB (dense index: %.1f KB)", index_pages_count, baked->IndexPages.Size, IM_FONTBAKED_INDEX_PAGE_SIZE, index_bytes / 1024.0, index_dense_bytes / 1024.0);
             for (int src_n = 0; src_n < font->Sources.Size; src_n++)
             {
                 ImFontConfig* src = font->Sources[src_n];
@@ -17195,7 +17735,13 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
             (window->ChildFlags & ImGuiChildFlags_NavFlattened) ? "NavFlattened " : "");
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
-    BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d, RenderOccluded: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems, window->RenderOccluded);
+    if (flags & ImGuiWindowFlags_CacheLabelSizes)
+    {
+        const ImGuiLabelSizeCache& cache = window->LabelSizeCache;
+        const int lookups = cache.HitsPrev + cache.MissesPrev;
+        BulletText("LabelSizeCache: %d entries, last frame %d hits, %d misses (%.1f%% hit rate)", cache.EntriesPrev.Size, cache.HitsPrev, cache.MissesPrev, lookups > 0 ? cache.HitsPrev * 100.0f / lookups : 0.0f);
+    }
     for (int layer = 0; layer < ImGuiNavLayer_COUNT; layer++)
     {
         ImRect r = window->NavRectRel[layer];
@@ -168,10 +168,11 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 16 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
+struct ImFontAtlasSharedData;       // Opaque storage for a ImFontAtlas shared across threads (see ImFontAtlas::LockFn)
 struct ImFontAtlasRect;             // Output of ImFontAtlas::GetCustomRect() when using custom rectangles.
 struct ImFontBaked;                 // Baked data for a ImFont at a given size.
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
@@ -191,6 +192,7 @@ struct ImGuiListClipper;            // Helper to manually clip large list of ite
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotStream;             // Helper to hold a ring buffer of samples and cached geometry for PlotLinesStream()
 struct ImGuiPlatformIO;             // Interface between platform/renderer backends and ImGui (e.g. Clipboard, IME hooks). Extends ImGuiIO. In docking branch, this gets extended to support multi-viewports.
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
@@ -205,6 +207,8 @@ struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
+struct ImGuiVirtualTree;            // Helper to display very large trees with ImGuiListClipper, maintaining a flattened list of visible nodes
+struct ImGuiVirtualTreeRow;         // A visible node of ImGuiVirtualTree
 
 // Enumerations
 // - We don't use strongly typed enums much because they add constraints (can't extend in private code, can't store typed in bit fields, extra casting on iteration)
@@ -469,6 +473,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll);                                  // set next window scrolling value (use < 0.0f to not affect a given axis).
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowRefreshRate(float refresh_rate);                               // [BETA] set next window contents refresh rate in Hz (0.0f: every frame). On other frames Begin() returns false and the previous contents are displayed again, unless the window is hovered, receives inputs, or gets moved/resized. Always call End().
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0, 0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -651,6 +656,7 @@ namespace ImGui
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* const items[], int items_count, int popup_max_height_in_items = -1);
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* items_separated_by_zeros, int popup_max_height_in_items = -1);      // Separate items with \0 within a string, end item-list with \0\0. e.g. "One\0Two\0Three\0"
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, int popup_max_height_in_items = -1);
+    IMGUI_API bool          ComboFiltered(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, int data_version = 0, int popup_max_height_in_items = -1); // combo with a filter field, for very large lists. items text is indexed on first open and reused until 'data_version' or 'items_count' changes.
 
     // Widgets: Drag Sliders
     // - CTRL+Click on any drag box to turn them into an input box. Manually input values aren't clamped by default and can go off-bounds. Use ImGuiSliderFlags_AlwaysClamp to always clamp.
@@ -746,6 +752,7 @@ namespace ImGui
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags = 0); // when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
     IMGUI_API void          SetNextItemStorageID(ImGuiID storage_id);                           // set id to use for open/close storage (default to same as item id).
+    IMGUI_API bool          VirtualTreeNode(ImGuiVirtualTree* tree, int row_n, const char* label, ImGuiTreeNodeFlags flags = 0); // display a row of ImGuiVirtualTree (indented according to depth). return open state. doesn't push on ID stack. user doesn't have to call TreePop().
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
@@ -783,6 +790,7 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLinesStream(const char* label, ImGuiPlotStream* stream, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0)); // scrolling plot of samples added with stream->AddSample(). only tessellates segments added since last call.
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -884,12 +892,16 @@ namespace ImGui
     //        - TableNextRow() -> TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK
     //        -                   TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK: TableNextColumn() automatically gets to next row!
     //        - TableNextRow()                           -> Text("Hello 0")                                               // Not OK! Missing TableSetColumnIndex() or TableNextColumn()! Text will not appear!
+    //    - For large grids of plain text, TableTextRows() submits a range of rows in one call. Combine with ImGuiListClipper
+    //      and pass clipper.DisplayStart/DisplayEnd. Use the getter version to map displayed rows to e.g. sorted indices.
     // - 5. Call EndTable()
     IMGUI_API bool          BeginTable(const char* str_id, int columns, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
     IMGUI_API void          EndTable();                                         // only call EndTable() if BeginTable() returns true!
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row.
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
+    IMGUI_API void          TableTextRows(const char* const* const* columns_values, int row_start, int row_end); // submit rows [row_start,row_end) of single-line text cells, reading columns_values[column_n][row_n]. Same output as TableNextRow() + TableNextColumn() + TextUnformatted() for every cell.
+    IMGUI_API void          TableTextRows(const char* (*values_getter)(void* data, int row_n, int column_n), void* data, int row_start, int row_end);
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -1161,6 +1173,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 16,  // No keyboard/gamepad navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 17,  // No focusing toward this window with keyboard/gamepad navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 18,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_CacheLabelSizes        = 1 << 20,  // Reuse label sizes measured on previous frame for items submitted in the same order (e.g. large property grids). Stats are displayed in Metrics/Debugger.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -2378,8 +2391,13 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires ImGuiBackendFlags_HasMouseCursors for better mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly;  // = false      // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
+    bool        ConfigWindowsOcclusionCulling;  // = false          // [BETA] Don't output draw lists of windows fully covered by opaque windows above them. Saves vertex processing in backends without a cheap scissor (e.g. CPU clipping).
+    bool        ConfigWindowsOcclusionSkipItems;// = false          // [BETA] Requires ConfigWindowsOcclusionCulling. Begin() returns false for windows that were fully covered on the previous frame. Uncovered windows may display one frame of missing contents.
+    bool        ConfigDrawListCulling;          // = false          // [BETA] ImDrawList primitives entirely outside of their clip rectangle are not emitted (sets ImDrawListFlags_CullOffscreen). Saves vertices on large pan/zoom canvases. Don't enable if you transform vertices or widen clip rectangles after submission.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigMemoryCompactBudget;      // = 0              // If > 0: bytes of draw list buffers that inactive windows may retain. Windows unused for ConfigMemoryCompactTimer are only trimmed toward their recent high-water mark while under budget, and fully freed (least recently used first) when over it. 0: always free.
+    int         ConfigMemoryCompactMaxBytesPerFrame; // = 0         // If > 0: limit amount of bytes freed or moved by memory compaction every frame, spreading large compactions over multiple frames. 0: no limit.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2495,6 +2513,8 @@ struct ImGuiIO
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
+    int         MetricsRenderWindowsOccluded;       // Number of visible windows whose draw lists were skipped because they were fully covered (io.ConfigWindowsOcclusionCulling)
+    int         MetricsRenderVerticesCulled;        // Vertices not emitted during last frame because their primitive was outside of its clip rectangle (ImDrawListFlags_CullOffscreen)
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
@@ -2823,6 +2843,85 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Flattened tree for very large hierarchies, displayed with ImGuiListClipper.
+// - TreeNode() trees can't be clipped as opening/closing nodes changes which rows are visible, so every open node needs to be submitted.
+// - This maintains Rows[], a flattened list of currently visible nodes, updated incrementally when a node is opened or closed.
+//   Per-frame cost is O(visible rows on screen), opening/closing a node is O(visible rows in its subtree).
+// - Hierarchy is accessed through adapter functions. Nodes are opaque void* (e.g. pointer or index). The root node is NULL and not displayed.
+// - Open state is stored in OpenStorage, keyed by node id. Call Rebuild() or set NeedRebuild after modifying the hierarchy.
+// - Open/close requests from VirtualTreeNode() are applied by the next call to Update(), as the row count can't change while clipping.
+// Usage:
+//   tree.UserData = my_scene;
+//   tree.AdapterGetChildCount = [](ImGuiVirtualTree* self, void* node) { return node ? ((MyNode*)node)->Children.Size : ((MyScene*)self->UserData)->Roots.Size; };
+//   tree.AdapterGetChild = [](ImGuiVirtualTree* self, void* node, int n) -> void* { return node ? ((MyNode*)node)->Children[n] : ((MyScene*)self->UserData)->Roots[n]; };
+//   [...]
+//   ImGuiListClipper clipper;
+//   clipper.Begin(tree.Update());
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           ImGui::VirtualTreeNode(&tree, row_n, ((MyNode*)tree.Rows[row_n].Node)->Name);
+struct ImGuiVirtualTreeRow
+{
+    void*           Node;           // User node
+    ImGuiID         NodeId;         // Value returned by AdapterGetNodeId()
+    int             Depth;          // 0 for children of the root node
+    int             ChildCount;     // Value returned by AdapterGetChildCount() when the row was added
+};
+
+struct ImGuiVirtualTree
+{
+    // Members
+    void*           UserData;       // = NULL   // User data for use by adapter functions
+    int             (*AdapterGetChildCount)(ImGuiVirtualTree* self, void* node);            // Return number of children of 'node' (NULL for root)
+    void*           (*AdapterGetChild)(ImGuiVirtualTree* self, void* node, int n);          // Return n-th child of 'node' (NULL for root)
+    ImGuiID         (*AdapterGetNodeId)(ImGuiVirtualTree* self, void* node);                // Optional: return persistent id of 'node'. Default to hashing the node pointer.
+    bool            NeedRebuild;    // = true   // Set to rebuild Rows[] on next Update(), e.g. after modifying the hierarchy.
+    ImVector<ImGuiVirtualTreeRow> Rows;         // Visible rows, in display order.
+    ImGuiStorage    OpenStorage;    //          // Open state, keyed by node id. Think of this as similar to e.g. std::set<ImGuiID>.
+    ImVector<int>   _PendingToggles;// [Internal] Rows toggled by VirtualTreeNode() this frame
+    ImVector<ImGuiVirtualTreeRow> _TempRows;    // [Internal]
+    ImVector<int>   _TempStack;     // [Internal]
+
+    // Methods
+    IMGUI_API ImGuiVirtualTree();
+    IMGUI_API int   Update();                                   // Apply pending open/close requests (and rebuild if needed). Return Rows.Size, to pass to ImGuiListClipper::Begin().
+    IMGUI_API void  Rebuild();                                  // Rebuild Rows[] from the hierarchy and OpenStorage. O(visible rows).
+    IMGUI_API void  SetRowOpen(int row_n, bool open);           // Open/close a node and insert/remove its visible subtree. Don't call while clipping.
+    IMGUI_API bool  IsNodeOpen(ImGuiID node_id) const;
+    IMGUI_API ImGuiID GetNodeId(void* node);
+};
+
+// Helper: Ring buffer of samples for PlotLinesStream(), a scrolling real-time plot.
+// - Samples are appended with AddSample(). Once Values.Size samples are stored, the oldest sample is overwritten.
+// - PlotLinesStream() caches the tessellated geometry of each line segment. Each frame it only tessellates segments added since the
+//   previous frame, and scrolls cached segments by translating their vertices. Per-frame tessellation cost is O(new samples).
+// - Cached geometry is rebuilt when the plot size, scale, color or draw list settings change.
+//   When not specifying scale_min/scale_max, the scale is RangeMin/RangeMax: it grows to fit new samples with a 25% margin (so drifting data doesn't
+//   rebuild every frame), and is refitted every Values.Size samples when the samples use less than half of it.
+// Usage:
+//   static ImGuiPlotStream stream(512);
+//   stream.AddSample(GetMyValue());
+//   ImGui::PlotLinesStream("Telemetry", &stream);
+struct ImGuiPlotStream
+{
+    ImVector<float> Values;         // Ring buffer of samples. Values.Size is the capacity.
+    int             Count;          // Number of valid samples (<= Values.Size)
+    int             Head;           // Index in Values[] where the next sample will be written
+    float           RangeMin;       // Range containing all samples (with some margin), used when PlotLinesStream() is not given scale_min/scale_max.
+    float           RangeMax;
+    int             _RangeRefitCounter; // [Internal] Samples added since last refit of RangeMin/RangeMax
+    int             _NewCount;      // [Internal] Samples added since last PlotLinesStream() call
+    void*           TempData;       // [Internal] Cached geometry (ImGuiPlotStreamCache)
+
+    // Methods
+    IMGUI_API ImGuiPlotStream(int capacity = 0);
+    IMGUI_API ~ImGuiPlotStream();
+    IMGUI_API void  SetCapacity(int capacity);                  // Resize ring buffer. Clear samples.
+    IMGUI_API void  AddSample(float v);
+    IMGUI_API void  Clear();
+    float           GetSample(int n) const { IM_ASSERT(n >= 0 && n < Count); int i = Head - Count + n; return Values.Data[i < 0 ? i + Values.Size : i]; } // n == 0 is the oldest sample
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -3111,7 +3210,24 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Texture coordinates stored as 16-bit normalized values (see IMGUI_USE_COMPACT_DRAWVERT in imconfig.h)
+// Converts to/from ImVec2 on assignment, e.g. 'vtx.uv = ImVec2(u, v);' and 'ImVec2 uv = vtx.uv;'
+struct ImDrawVertUV
+{
+    ImU16   x, y;
+    ImDrawVertUV()                      { }
+    ImDrawVertUV(const ImVec2& uv)      { x = Pack(uv.x); y = Pack(uv.y); }
+    operator ImVec2() const             { return ImVec2(x * (1.0f / 65535.0f), y * (1.0f / 65535.0f)); }
+    static ImU16 Pack(float v)          { return (v <= 0.0f) ? (ImU16)0 : (v >= 1.0f) ? (ImU16)65535 : (ImU16)(v * 65535.0f + 0.5f); }
+};
+struct ImDrawVert
+{
+    ImVec2          pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -3187,6 +3303,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_CullOffscreen           = 1 << 4,  // Don't emit primitives whose bounding box is entirely outside the current clip rectangle. Long polylines are culled per chunk of segments. Set when 'io.ConfigDrawListCulling' is enabled.
 };
 
 // Draw command list
@@ -3218,6 +3335,7 @@ struct ImDrawList
     ImVector<ImTextureRef>  _TextureStack;      // [Internal]
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    int                     _CulledVtxCount;    // [Internal] vertices not emitted since last reset because of ImDrawListFlags_CullOffscreen
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData().
@@ -3351,6 +3469,7 @@ struct ImDrawList
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API void  _FillShapeTemplate(int a_step, int corners_mask, const ImVec2* centers, const float* radii, ImU32 col);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -3676,6 +3795,18 @@ struct ImFontAtlas
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
+    // Sharing an atlas between contexts running on different threads (requires ImGuiBackendFlags_RendererHasTextures)
+    // - Set both functions before any context uses the atlas. They need to implement a RECURSIVE lock (e.g. std::recursive_mutex, Win32 CRITICAL_SECTION).
+    // - Glyph lookups don't lock. Loading new glyphs or sizes and updating the texture are serialized using those functions.
+    // - Each context gets its own copy of atlas textures in GetPlatformIO().Textures[], so each renderer backend can create them on its own device.
+    // - Memory released by the atlas (e.g. when texture is resized) is only freed once every context has started a new frame.
+    // - Each context uses a copy of the atlas texture and its UV data, taken on NewFrame(). If another thread repacks the atlas during a frame, that frame may show misplaced glyphs, like when the texture is repacked mid-frame without sharing.
+    // - Other modifications of the atlas (AddFont, RemoveFont, Clear etc.) still need to happen while no context is using it.
+    // - The context owning the atlas must call NewFrame() once before other contexts call NewFrame(), or they will assert. Synchronize your threads startup accordingly.
+    void                        (*LockFn)(void* user_data);
+    void                        (*UnlockFn)(void* user_data);
+    void*                       LockUserData;
+
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
     // - This should not affect you as you can always use the latest value. But note that any precomputed UV coordinates are only valid for the current TexRef.
@@ -3707,6 +3838,7 @@ struct ImFontAtlas
     unsigned int                FontLoaderFlags;    // Shared flags (for all fonts) for font loader. THIS IS BUILD IMPLEMENTATION DEPENDENT (e.g. Per-font override is also available in ImFontConfig).
     int                         RefCount;           // Number of contexts using this atlas
     ImGuiContext*               OwnerContext;       // Context which own the atlas will be in charge of updating and destroying it.
+    ImFontAtlasSharedData*      SharedData;         // Created when LockFn is set: per-context state and deferred frees.
 
     // [Obsolete]
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -3725,18 +3857,25 @@ struct ImFontAtlas
     //typedef ImFontGlyphRangesBuilder  GlyphRangesBuilder;      // OBSOLETED in 1.67+
 };
 
+// [Internal] Page of ImFontBaked::IndexPages[], covering IM_FONTBAKED_INDEX_PAGE_SIZE consecutive codepoints.
+// Pages are only allocated for ranges where a codepoint has been looked up, so e.g. one emoji doesn't require an index covering all codepoints below it.
+#define IM_FONTBAKED_INDEX_PAGE_BITS    8
+#define IM_FONTBAKED_INDEX_PAGE_SIZE    (1 << IM_FONTBAKED_INDEX_PAGE_BITS)
+struct ImFontBakedIndexPage
+{
+    float                       AdvanceX[IM_FONTBAKED_INDEX_PAGE_SIZE]; // Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI). -1.0f if not loaded yet.
+    ImU16                       Lookup[IM_FONTBAKED_INDEX_PAGE_SIZE];   // Index into Glyphs[].
+};
+
 // Font runtime data for a given size
 // Important: pointers to ImFontBaked are only valid for the current frame.
 struct ImFontBaked
 {
-    // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
+    // [Internal] Members: Hot ~24/32 bytes (for CalcTextSize and RenderText loop)
+    ImVector<ImFontBakedIndexPage*> IndexPages;     // 12-16 // out // Two-level index by Unicode code-point: IndexPages[c >> IM_FONTBAKED_INDEX_PAGE_BITS] (NULL if no codepoint of that page was looked up).
     float                       FallbackAdvanceX;   // 4     // out // FindGlyph(FallbackChar)->AdvanceX
     float                       Size;               // 4     // in  // Height of characters/line, set during loading (doesn't change after loading)
     float                       RasterizerDensity;  // 4     // in  // Density this is baked at
-
-    // [Internal] Members: Hot ~28/36 bytes (for RenderText loop)
-    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Sparse. Index glyphs by Unicode code-point.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
 
@@ -3757,6 +3896,7 @@ struct ImFontBaked
     IMGUI_API ImFontGlyph*      FindGlyphNoFallback(ImWchar c);     // Return NULL if glyph doesn't exist
     IMGUI_API float             GetCharAdvance(ImWchar c);
     IMGUI_API bool              IsGlyphLoaded(ImWchar c);
+    IMGUI_API ImFontBakedIndexPage* GetIndexPage(unsigned int c) const;
 };
 
 // Font flags
@@ -3780,7 +3920,7 @@ struct ImFont
     ImFontBaked*                LastBaked;          // 4-8   // Cache last bound baked. NEVER USE DIRECTLY. Use GetFontBaked().
     ImFontAtlas*                ContainerAtlas;     // 4-8   // What we have been loaded into.
     ImFontFlags                 Flags;              // 4     // Font flags.
-    float                       CurrentRasterizerDensity;    // Current rasterizer density. This is a varying state of the font.
+    float                       CurrentRasterizerDensity;    // Current rasterizer density. This is a varying state of the font. Not updated when the atlas is shared between threads (see ImFontAtlas::LockFn).
 
     // [Internal] Members: Cold ~24-52 bytes
     // Conceptually Sources[] is the list of font sources merged to create this font.
@@ -511,6 +511,16 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
             ImGui::Checkbox("io.ConfigWindowsCopyContentsWithCtrlC", &io.ConfigWindowsCopyContentsWithCtrlC); // [EXPERIMENTAL]
             ImGui::SameLine(); HelpMarker("*EXPERIMENTAL* CTRL+C copy the contents of focused window into the clipboard.\n\nExperimental because:\n- (1) has known issues with nested Begin/End pairs.\n- (2) text output quality varies.\n- (3) text output is in submission order rather than spatial order.");
+            ImGui::Checkbox("io.ConfigWindowsOcclusionCulling", &io.ConfigWindowsOcclusionCulling);
+            ImGui::SameLine(); HelpMarker("Don't output draw lists of windows fully covered by opaque windows above them.\nWindows with a translucent background never occlude others.");
+            ImGui::BeginDisabled(!io.ConfigWindowsOcclusionCulling);
+            ImGui::Indent();
+            ImGui::Checkbox("io.ConfigWindowsOcclusionSkipItems", &io.ConfigWindowsOcclusionSkipItems);
+            ImGui::SameLine(); HelpMarker("Begin() returns false for windows which were fully covered on the previous frame.\nA window being uncovered may display one frame of missing contents.");
+            ImGui::Unindent();
+            ImGui::EndDisabled();
+            ImGui::Checkbox("io.ConfigDrawListCulling", &io.ConfigDrawListCulling);
+            ImGui::SameLine(); HelpMarker("ImDrawList primitives entirely outside of their clip rectangle are not emitted.\nLong polylines are culled per chunk of segments.");
             ImGui::Checkbox("io.ConfigScrollbarScrollByPage", &io.ConfigScrollbarScrollByPage);
             ImGui::SameLine(); HelpMarker("Enable scrolling page by page when clicking outside the scrollbar grab.\nWhen disabled, always scroll to clicked location.\nWhen enabled, Shift+Click scrolls to clicked location.");
 
@@ -1371,6 +1381,11 @@ static void DemoWindowWidgetsComboBoxes()
         static int item_current_4 = 0;
         ImGui::Combo("combo 5 (function)", &item_current_4, [](void* data, int n) { return ((const char**)data)[n]; }, items, IM_ARRAYSIZE(items));
 
+        // ComboFiltered() for very large lists: items are clipped, and a filter field uses an index built on first open.
+        // Pass a different 'data_version' value whenever your items text changes.
+        static int item_current_5 = 0;
+        ImGui::ComboFiltered("combo 6 (50000 items, filter)", &item_current_5, [](void*, int n) { static char buf[32]; snprintf(buf, IM_ARRAYSIZE(buf), "Asset %05d_%s", n, (n % 3) ? "Texture" : "Mesh"); return (const char*)buf; }, NULL, 50000);
+
         ImGui::TreePop();
     }
 }
@@ -2030,6 +2045,18 @@ static void DemoWindowWidgetsPlotting()
         ImGui::PlotLines("Lines##2", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram##2", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
 
+        // Streaming: samples are appended to a ring buffer, only new segments are tessellated each frame.
+        static ImGuiPlotStream stream(500);
+        ImGui::SeparatorText("Streaming");
+        if (animate)
+        {
+            static float stream_phase = 0.0f;
+            for (int n = 0; n < 4; n++, stream_phase += 0.02f)
+                stream.AddSample(sinf(stream_phase) + sinf(stream_phase * 7.3f) * 0.2f);
+        }
+        ImGui::PlotLinesStream("Stream", &stream, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::SameLine(); HelpMarker("PlotLinesStream() caches the geometry of each line segment and only tessellates segments added since last frame.\nAuto-fit range is recomputed every 500 samples.");
+
         ImGui::TreePop();
     }
 }
@@ -4151,6 +4178,36 @@ static void DemoWindowWidgetsTreeNodes()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Tree Nodes/Virtual tree (very large)");
+        if (ImGui::TreeNode("Virtual tree (very large)"))
+        {
+            // ImGuiVirtualTree keeps a flattened list of visible nodes so the tree can be clipped with ImGuiListClipper.
+            // Our hierarchy here is procedural: 10 roots, 10 children per node, 6 levels = 1111110 nodes. Node n has children n*10+1..n*10+10.
+            // Nodes are encoded in the void* handle, and the root is NULL (0).
+            HelpMarker("1111110 nodes. Only visible rows are submitted, whatever the number of open nodes.");
+            static ImGuiVirtualTree tree;
+            if (tree.AdapterGetChild == NULL)
+            {
+                tree.AdapterGetChildCount = [](ImGuiVirtualTree*, void* node) { return ((intptr_t)node < 111111) ? 10 : 0; };
+                tree.AdapterGetChild = [](ImGuiVirtualTree*, void* node, int n) { return (void*)((intptr_t)node * 10 + n + 1); };
+            }
+            ImGui::Text("%d visible rows", tree.Rows.Size);
+            if (ImGui::BeginChild("##tree", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 15), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiListClipper clipper;
+                clipper.Begin(tree.Update());
+                while (clipper.Step())
+                    for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                    {
+                        char label[32];
+                        snprintf(label, IM_ARRAYSIZE(label), "Node %d", (int)(intptr_t)tree.Rows[row_n].Node);
+                        ImGui::VirtualTreeNode(&tree, row_n, label, ImGuiTreeNodeFlags_SpanAvailWidth);
+                    }
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 }
@@ -6239,6 +6296,56 @@ static void DemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Bulk text rows");
+    if (ImGui::TreeNode("Bulk text rows"))
+    {
+        HelpMarker(
+            "TableTextRows() submits a range of rows of single-line text in one call, "
+            "which is much cheaper than TableNextRow() + TableNextColumn() + TextUnformatted() for each cell.\n\n"
+            "Here we pass clipper.DisplayStart/DisplayEnd and read from one array of strings per column.");
+        const int COLUMNS_COUNT = 12;
+        const int ROWS_COUNT = 10000;
+        static ImGuiTextBuffer text_buf;
+        static ImVector<const char*> columns_storage;
+        static const char* const* columns_values[COLUMNS_COUNT];
+        if (text_buf.empty())
+        {
+            // Store offsets first as the buffer may be reallocated while we append to it
+            ImVector<int> offsets;
+            for (int column = 0; column < COLUMNS_COUNT; column++)
+                for (int row = 0; row < ROWS_COUNT; row++)
+                {
+                    offsets.push_back(text_buf.size());
+                    text_buf.appendf("Cell %d,%d", column, row);
+                    text_buf.Buf.push_back(0); // Keep a zero-terminator after each string, the next append starts after it
+                }
+            columns_storage.resize(offsets.Size);
+            for (int n = 0; n < offsets.Size; n++)
+                columns_storage[n] = text_buf.begin() + offsets[n];
+            for (int column = 0; column < COLUMNS_COUNT; column++)
+                columns_values[column] = &columns_storage[column * ROWS_COUNT];
+        }
+
+        static ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_ScrollX | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+        ImVec2 outer_size = ImVec2(0.0f, TEXT_BASE_HEIGHT * 12);
+        if (ImGui::BeginTable("table_bulk", COLUMNS_COUNT, flags, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(1, 1);
+            for (int column = 0; column < COLUMNS_COUNT; column++)
+                ImGui::TableSetupColumn(column == 0 ? "Col 0" : "Col N", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+            ImGui::TableHeadersRow();
+
+            ImGuiListClipper clipper;
+            clipper.Begin(ROWS_COUNT);
+            while (clipper.Step())
+                ImGui::TableTextRows(columns_values, clipper.DisplayStart, clipper.DisplayEnd);
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Horizontal scrolling");
@@ -8129,6 +8236,9 @@ void ImGui::ShowAboutWindow(bool* p_open)
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
         ImGui::Text("define: IMGUI_USE_BGRA_PACKED_COLOR");
 #endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        ImGui::Text("define: IMGUI_USE_COMPACT_DRAWVERT");
+#endif
 #ifdef _WIN32
         ImGui::Text("define: _WIN32");
 #endif
@@ -8179,7 +8289,12 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigInputTextCursorBlink)                              ImGui::Text("io.ConfigInputTextCursorBlink");
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
+        if (io.ConfigWindowsOcclusionCulling)                           ImGui::Text("io.ConfigWindowsOcclusionCulling");
+        if (io.ConfigWindowsOcclusionSkipItems)                         ImGui::Text("io.ConfigWindowsOcclusionSkipItems");
+        if (io.ConfigDrawListCulling)                                   ImGui::Text("io.ConfigDrawListCulling");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigMemoryCompactBudget > 0)                           ImGui::Text("io.ConfigMemoryCompactBudget = %d", io.ConfigMemoryCompactBudget);
+        if (io.ConfigMemoryCompactMaxBytesPerFrame > 0)                 ImGui::Text("io.ConfigMemoryCompactMaxBytesPerFrame = %d", io.ConfigMemoryCompactMaxBytesPerFrame);
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
@@ -9663,10 +9778,11 @@ static void ShowExampleAppConstrainedResize(bool* p_open)
 //-----------------------------------------------------------------------------
 
 // Demonstrate creating a simple static window with no decoration
-// + a context-menu to choose which corner of the screen to use.
+// + a context-menu to choose which corner of the screen to use and a refresh rate.
 static void ShowExampleAppSimpleOverlay(bool* p_open)
 {
     static int location = 0;
+    static float refresh_rate = 0.0f;
     ImGuiIO& io = ImGui::GetIO();
     ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
     if (location >= 0)
@@ -9690,6 +9806,7 @@ static void ShowExampleAppSimpleOverlay(bool* p_open)
         window_flags |= ImGuiWindowFlags_NoMove;
     }
     ImGui::SetNextWindowBgAlpha(0.35f); // Transparent background
+    ImGui::SetNextWindowRefreshRate(refresh_rate); // When not refreshed, Begin() returns false and last contents are displayed again
     if (ImGui::Begin("Example: Simple overlay", p_open, window_flags))
     {
         IMGUI_DEMO_MARKER("Examples/Simple Overlay");
@@ -9707,6 +9824,10 @@ static void ShowExampleAppSimpleOverlay(bool* p_open)
             if (ImGui::MenuItem("Top-right",    NULL, location == 1)) location = 1;
             if (ImGui::MenuItem("Bottom-left",  NULL, location == 2)) location = 2;
             if (ImGui::MenuItem("Bottom-right", NULL, location == 3)) location = 3;
+            ImGui::Separator();
+            if (ImGui::MenuItem("Refresh every frame", NULL, refresh_rate == 0.0f)) refresh_rate = 0.0f;
+            if (ImGui::MenuItem("Refresh at 4 Hz",     NULL, refresh_rate == 4.0f)) refresh_rate = 4.0f;
+            ImGui::Separator();
             if (p_open && ImGui::MenuItem("Close")) *p_open = false;
             ImGui::EndPopup();
         }
@@ -137,8 +137,11 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+static void*                ImGui_ImplStbTrueType_ScratchAlloc(size_t size, void* user_data);
+static void                 ImGui_ImplStbTrueType_ScratchFree(void* ptr, void* user_data);
+#define IMGUI_STB_TRUETYPE_USE_SCRATCH                          // stbtt_fontinfo::userdata may point to a ImGui_ImplStbTrueType_Scratch
+#define STBTT_malloc(x,u)   ImGui_ImplStbTrueType_ScratchAlloc(x,u)
+#define STBTT_free(x,u)     ImGui_ImplStbTrueType_ScratchFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -460,6 +463,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = _Data->InitialFringeScale;
+    _CulledVtxCount = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -790,12 +794,154 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Cull-on-emit (ImDrawListFlags_CullOffscreen)
+// - A primitive is skipped when its bounding box, expanded by the distance its geometry may extend beyond its points, is entirely outside of _CmdHeader.ClipRect.
+// - A join normal fixed by IM_FIXNORMAL2F() is at most sqrt(IM_FIXNORMAL2F_MAX_INVLEN2) long: strokes and AA fringes extend at most that many half-widths away from their points.
+// - Skipped vertices are accumulated in _CulledVtxCount, using the same counts the primitive would have reserved.
+#define IM_DRAWLIST_CULL_JOIN_EXTENT        10.0f // sqrt(IM_FIXNORMAL2F_MAX_INVLEN2)
+
+static inline bool IsOutsideClipRect(const ImDrawList* draw_list, const ImRect& bb, float margin)
+{
+    const ImVec4& clip = draw_list->_CmdHeader.ClipRect;
+    return bb.Max.x + margin < clip.x || bb.Max.y + margin < clip.y || bb.Min.x - margin > clip.z || bb.Min.y - margin > clip.w;
+}
+
+static inline ImRect CalcPointsBoundingBox(const ImVec2* points, const int points_count)
+{
+    ImRect bb(points[0], points[0]);
+    for (int n = 1; n < points_count; n++)
+        bb.Add(points[n]);
+    return bb;
+}
+
+static inline float CalcStrokeCullMargin(const ImDrawList* draw_list, float thickness)
+{
+    return (ImMax(thickness, 1.0f) * 0.5f + draw_list->_FringeScale) * IM_DRAWLIST_CULL_JOIN_EXTENT;
+}
+
+static inline float CalcFillCullMargin(const ImDrawList* draw_list)
+{
+    return draw_list->_FringeScale * 0.5f * IM_DRAWLIST_CULL_JOIN_EXTENT;
+}
+
+// Same vertex count as AddPolyline()
+static int CalcPolylineVtxCount(const ImDrawList* draw_list, const int points_count, ImDrawFlags flags, float thickness)
+{
+    if (points_count < 2)
+        return 0;
+    const bool thick_line = (thickness > draw_list->_FringeScale);
+    if (draw_list->Flags & ImDrawListFlags_AntiAliasedLines)
+    {
+        thickness = ImMax(thickness, 1.0f);
+        const int integer_thickness = (int)thickness;
+        const float fractional_thickness = thickness - integer_thickness;
+        const bool use_texture = (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (draw_list->_FringeScale == 1.0f);
+        return use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
+    }
+    const int count = (flags & ImDrawFlags_Closed) ? points_count : points_count - 1;
+    return count * 4;
+}
+
+// Same vertex count as AddConvexPolyFilled() and AddConcavePolyFilled()
+static inline int CalcPolyFilledVtxCount(const ImDrawList* draw_list, const int points_count)
+{
+    if (points_count < 3)
+        return 0;
+    return (draw_list->Flags & ImDrawListFlags_AntiAliasedFill) ? points_count * 2 : points_count;
+}
+
+// Number of points of a full circle output by _PathArcToFastEx() with automatic step, once the duplicate closing point is removed.
+static int CalcArcFastCirclePointsCount(const ImDrawList* draw_list, float radius)
+{
+    if (radius < 0.5f)
+        return 0;
+    const int a_step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / draw_list->_CalcCircleAutoSegmentCount(radius), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4);
+    int samples = IM_DRAWLIST_ARCFAST_SAMPLE_MAX + 1;
+    if (a_step > 1)
+        samples = IM_DRAWLIST_ARCFAST_SAMPLE_MAX / a_step + 1 + ((IM_DRAWLIST_ARCFAST_SAMPLE_MAX % a_step) > 0 ? 1 : 0);
+    return samples - 1;
+}
+
+// Emit segments [seg_begin, seg_end) of a polyline as an open polyline. seg_end may go past the last point of a closed polyline.
+static void AddPolylineRun(ImDrawList* draw_list, const ImVec2* points, const int points_count, int seg_begin, int seg_end, ImU32 col, float thickness)
+{
+    const ImDrawListFlags backup_flags = draw_list->Flags;
+    draw_list->Flags &= ~ImDrawListFlags_CullOffscreen;
+    if (seg_end < points_count)
+    {
+        draw_list->AddPolyline(points + seg_begin, seg_end - seg_begin + 1, col, ImDrawFlags_None, thickness);
+    }
+    else
+    {
+        ImVector<ImVec2> run_points;
+        run_points.resize(seg_end - seg_begin + 1);
+        for (int n = 0; n < run_points.Size; n++)
+            run_points[n] = points[(seg_begin + n) % points_count];
+        draw_list->AddPolyline(run_points.Data, run_points.Size, col, ImDrawFlags_None, thickness);
+    }
+    draw_list->Flags = backup_flags;
+}
+
+// Cull-on-emit for AddPolyline(). Return false when the polyline needs to be emitted as usual.
+// Long polylines are tested per chunk of IM_DRAWLIST_CULL_CHUNK_SEGMENTS segments, and runs of visible chunks are emitted as open polylines.
+// The shape of a segment depends on the joins at both of its ends, so runs are extended by one segment into neighboring culled chunks:
+// the caps replacing joins, and the extra segments themselves, are then within culled chunks and not visible.
+static bool AddPolylineCulled(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
+{
+    const float margin = CalcStrokeCullMargin(draw_list, thickness);
+    const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    const int segments_count = closed ? points_count : points_count - 1;
+    if (segments_count < IM_DRAWLIST_CULL_CHUNK_SEGMENTS * 2)
+    {
+        if (!IsOutsideClipRect(draw_list, CalcPointsBoundingBox(points, points_count), margin))
+            return false;
+        draw_list->_CulledVtxCount += CalcPolylineVtxCount(draw_list, points_count, flags, thickness);
+        return true;
+    }
+
+    // On a closed polyline, a run starting on the first segment is emitted last, as the final run may wrap around into it.
+    IM_STATIC_ASSERT(IM_DRAWLIST_CULL_CHUNK_SEGMENTS >= 3); // Extended runs never overlap
+    const int vtx_count_before = draw_list->VtxBuffer.Size;
+    int run_begin = -1;
+    int head_run_end = -1;
+    bool culled_any = false;
+    for (int seg_begin = 0, seg_end = 0; seg_begin < segments_count; seg_begin = seg_end)
+    {
+        seg_end = (segments_count - seg_begin < IM_DRAWLIST_CULL_CHUNK_SEGMENTS * 2) ? segments_count : seg_begin + IM_DRAWLIST_CULL_CHUNK_SEGMENTS; // Last chunk takes the remainder
+        ImRect bb = CalcPointsBoundingBox(points + seg_begin, seg_end - seg_begin);
+        bb.Add(points[seg_end < points_count ? seg_end : 0]);
+        if (!IsOutsideClipRect(draw_list, bb, margin))
+        {
+            if (run_begin < 0)
+                run_begin = seg_begin;
+            continue;
+        }
+        culled_any = true;
+        if (run_begin == 0 && closed)
+            head_run_end = seg_begin;
+        else if (run_begin >= 0)
+            AddPolylineRun(draw_list, points, points_count, ImMax(run_begin - 1, 0), seg_begin + 1, col, thickness);
+        run_begin = -1;
+    }
+    if (!culled_any)
+        return false;
+
+    if (run_begin >= 0)
+        AddPolylineRun(draw_list, points, points_count, ImMax(run_begin - 1, 0), closed ? segments_count + ImMax(head_run_end, 0) + 1 : segments_count, col, thickness);
+    else if (head_run_end > 0)
+        AddPolylineRun(draw_list, points, points_count, segments_count - 1, segments_count + head_run_end + 1, col, thickness); // Start with the closing segment
+    draw_list->_CulledVtxCount += CalcPolylineVtxCount(draw_list, points_count, flags, thickness) - (draw_list->VtxBuffer.Size - vtx_count_before);
+    return true;
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && AddPolylineCulled(this, points, points_count, col, flags, thickness))
+        return;
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
@@ -1054,6 +1200,11 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, CalcPointsBoundingBox(points, points_count), CalcFillCullMargin(this)))
+    {
+        _CulledVtxCount += CalcPolyFilledVtxCount(this, points_count);
+        return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -1132,6 +1283,136 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     }
 }
 
+// Build anti-aliased fill template for a circle (corners_mask == 0) or a rounded rectangle (corners_mask: 1 = top-left, 2 = top-right, 4 = bottom-right, 8 = bottom-left).
+// Points are the ones _PathArcToFastEx() would output for a unit radius. Normals are computed like AddConvexPolyFilled() does, on a reference shape.
+static ImVec2ih BuildShapeTemplate(ImDrawList* draw_list, int a_step, int corners_mask)
+{
+    ImDrawListSharedData* data = draw_list->_Data;
+    ImVector<ImVec2>& path = draw_list->_Path;
+    const int path_backup_size = path.Size;
+    const int points_offset = data->ShapeTemplatePoints.Size;
+
+    // Reference shape: unit circle, or rectangle (0,0)-(8,8) with a rounding of 2
+    ImVec2 ref_centers[4] = { ImVec2(0.0f, 0.0f), ImVec2(0.0f, 0.0f), ImVec2(0.0f, 0.0f), ImVec2(0.0f, 0.0f) };
+    float ref_radii[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    if (corners_mask == 0)
+    {
+        draw_list->_PathArcToFastEx(ImVec2(0.0f, 0.0f), 1.0f, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, a_step);
+        path.Size--;
+        for (int n = path_backup_size; n < path.Size; n++)
+            data->ShapeTemplatePoints.push_back({ path.Data[n], ImVec2(0.0f, 0.0f), 0 });
+    }
+    else
+    {
+        static const int corner_arcs[4][2] = { { 6, 9 }, { 9, 12 }, { 0, 3 }, { 3, 6 } }; // Same as PathRect()
+        for (int corner = 0; corner < 4; corner++)
+        {
+            const bool rounded = (corners_mask & (1 << corner)) != 0;
+            ref_radii[corner] = rounded ? 2.0f : 0.0f;
+            ref_centers[corner].x = (corner == 0 || corner == 3) ? ref_radii[corner] : 8.0f - ref_radii[corner];
+            ref_centers[corner].y = (corner == 0 || corner == 1) ? ref_radii[corner] : 8.0f - ref_radii[corner];
+            if (!rounded)
+            {
+                data->ShapeTemplatePoints.push_back({ ImVec2(0.0f, 0.0f), ImVec2(0.0f, 0.0f), corner });
+                continue;
+            }
+            const int corner_path_start = path.Size;
+            draw_list->_PathArcToFastEx(ImVec2(0.0f, 0.0f), 1.0f, corner_arcs[corner][0] * IM_DRAWLIST_ARCFAST_SAMPLE_MAX / 12, corner_arcs[corner][1] * IM_DRAWLIST_ARCFAST_SAMPLE_MAX / 12, a_step);
+            for (int n = corner_path_start; n < path.Size; n++)
+                data->ShapeTemplatePoints.push_back({ path.Data[n], ImVec2(0.0f, 0.0f), corner });
+        }
+    }
+    path.Size = path_backup_size;
+
+    // Compute normals on reference shape
+    ImDrawListShapePoint* points = data->ShapeTemplatePoints.Data + points_offset;
+    const int points_count = data->ShapeTemplatePoints.Size - points_offset;
+    data->TempBuffer.reserve_discard(points_count * 2);
+    ImVec2* ref_points = data->TempBuffer.Data;
+    ImVec2* temp_normals = data->TempBuffer.Data + points_count;
+    for (int n = 0; n < points_count; n++)
+        ref_points[n] = ImVec2(ref_centers[points[n].Corner].x + points[n].Dir.x * ref_radii[points[n].Corner], ref_centers[points[n].Corner].y + points[n].Dir.y * ref_radii[points[n].Corner]);
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+    {
+        float dx = ref_points[i1].x - ref_points[i0].x;
+        float dy = ref_points[i1].y - ref_points[i0].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        temp_normals[i0].x = dy;
+        temp_normals[i0].y = -dx;
+    }
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+    {
+        float dm_x = (temp_normals[i0].x + temp_normals[i1].x) * 0.5f;
+        float dm_y = (temp_normals[i0].y + temp_normals[i1].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        points[i1].Normal = ImVec2(dm_x, dm_y);
+    }
+    IM_ASSERT(data->ShapeTemplatePoints.Size <= 0x7FFF);
+    return ImVec2ih((short)points_offset, (short)points_count);
+}
+
+// Anti-aliased fill of a circle or rounded rectangle: same output as building the path with _PathArcToFastEx() and calling AddConvexPolyFilled(),
+// but points and fringe normals come from a template cached in ImDrawListSharedData, so we skip the per-point normalization.
+void ImDrawList::_FillShapeTemplate(int a_step, int corners_mask, const ImVec2* centers, const float* radii, ImU32 col)
+{
+    IM_ASSERT(a_step >= 1 && a_step <= IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4 && corners_mask >= 0 && corners_mask < 16);
+    ImVec2ih shape = _Data->ShapeTemplates[a_step * 16 + corners_mask];
+    if (shape.y == 0)
+        shape = _Data->ShapeTemplates[a_step * 16 + corners_mask] = BuildShapeTemplate(this, a_step, corners_mask);
+    const ImDrawListShapePoint* points = _Data->ShapeTemplatePoints.Data + shape.x;
+    const int points_count = shape.y;
+    if (Flags & ImDrawListFlags_CullOffscreen)
+    {
+        ImRect bb(centers[0] - ImVec2(radii[0], radii[0]), centers[0] + ImVec2(radii[0], radii[0]));
+        for (int corner = 1; corner < (corners_mask != 0 ? 4 : 1); corner++)
+            bb.Add(ImRect(centers[corner] - ImVec2(radii[corner], radii[corner]), centers[corner] + ImVec2(radii[corner], radii[corner])));
+        if (IsOutsideClipRect(this, bb, CalcFillCullMargin(this)))
+        {
+            _CulledVtxCount += points_count * 2;
+            return;
+        }
+    }
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const float AA_SIZE = _FringeScale;
+    const float fringe_half = AA_SIZE * 0.5f;
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+    const int idx_count = (points_count - 2)*3 + points_count * 6;
+    const int vtx_count = (points_count * 2);
+    PrimReserve(idx_count, vtx_count);
+
+    // Add indexes for fill
+    unsigned int vtx_inner_idx = _VtxCurrentIdx;
+    unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
+    for (int i = 2; i < points_count; i++)
+    {
+        _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
+        _IdxWritePtr += 3;
+    }
+
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+    {
+        const ImDrawListShapePoint& point = points[i1];
+        const ImVec2 center = centers[point.Corner];
+        const float radius = radii[point.Corner];
+        const float p_x = center.x + point.Dir.x * radius;
+        const float p_y = center.y + point.Dir.y * radius;
+        const float dm_x = point.Normal.x * fringe_half;
+        const float dm_y = point.Normal.y * fringe_half;
+
+        // Add vertices
+        _VtxWritePtr[0].pos.x = (p_x - dm_x); _VtxWritePtr[0].pos.y = (p_y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+        _VtxWritePtr[1].pos.x = (p_x + dm_x); _VtxWritePtr[1].pos.y = (p_y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+        _VtxWritePtr += 2;
+
+        // Add indexes for fringes
+        _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+        _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+        _IdxWritePtr += 6;
+    }
+    _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+}
+
 void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step)
 {
     if (radius < 0.5f)
@@ -1442,13 +1723,19 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
+static inline float ClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
+    rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+    return rounding;
+}
+
 void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
 {
     if (rounding >= 0.5f)
     {
         flags = FixRectCornerFlags(flags);
-        rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
-        rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+        rounding = ClampRectRounding(a, b, rounding, flags);
     }
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
@@ -1498,11 +1785,37 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
+        if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(ImMin(p_min, p_max), ImMax(p_min, p_max)), 0.0f))
+        {
+            _CulledVtxCount += 4;
+            return;
+        }
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
     else
     {
+        if (Flags & ImDrawListFlags_AntiAliasedFill)
+        {
+            flags = FixRectCornerFlags(flags);
+            rounding = ClampRectRounding(p_min, p_max, rounding, flags);
+            if (rounding >= 0.5f)
+            {
+                // Same as PathRect() + PathFillConvex(), with fringe normals taken from a cached template
+                const float radii[4] =
+                {
+                    (flags & ImDrawFlags_RoundCornersTopLeft)     ? rounding : 0.0f,
+                    (flags & ImDrawFlags_RoundCornersTopRight)    ? rounding : 0.0f,
+                    (flags & ImDrawFlags_RoundCornersBottomRight) ? rounding : 0.0f,
+                    (flags & ImDrawFlags_RoundCornersBottomLeft)  ? rounding : 0.0f,
+                };
+                const ImVec2 centers[4] = { ImVec2(p_min.x + radii[0], p_min.y + radii[0]), ImVec2(p_max.x - radii[1], p_min.y + radii[1]), ImVec2(p_max.x - radii[2], p_max.y - radii[2]), ImVec2(p_min.x + radii[3], p_max.y - radii[3]) };
+                const int corners_mask = (radii[0] > 0.0f ? 1 : 0) | (radii[1] > 0.0f ? 2 : 0) | (radii[2] > 0.0f ? 4 : 0) | (radii[3] > 0.0f ? 8 : 0);
+                const int a_step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(rounding), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4);
+                _FillShapeTemplate(a_step, corners_mask, centers, radii, col);
+                return;
+            }
+        }
         PathRect(p_min, p_max, rounding, flags);
         PathFillConvex(col);
     }
@@ -1513,6 +1826,11 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(ImMin(p_min, p_max), ImMax(p_min, p_max)), 0.0f))
+    {
+        _CulledVtxCount += 4;
+        return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1574,6 +1892,12 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(center - ImVec2(radius, radius), center + ImVec2(radius, radius)), CalcStrokeCullMargin(this, thickness)))
+    {
+        const int points_count = (num_segments <= 0) ? CalcArcFastCirclePointsCount(this, radius - 0.5f) : ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        _CulledVtxCount += CalcPolylineVtxCount(this, points_count, ImDrawFlags_Closed, thickness);
+        return;
+    }
 
     if (num_segments <= 0)
     {
@@ -1598,11 +1922,23 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(center - ImVec2(radius, radius), center + ImVec2(radius, radius)), CalcFillCullMargin(this)))
+    {
+        const int points_count = (num_segments <= 0) ? CalcArcFastCirclePointsCount(this, radius) : ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        _CulledVtxCount += CalcPolyFilledVtxCount(this, points_count);
+        return;
+    }
 
     if (num_segments <= 0)
     {
         // Use arc with automatic segment count
-        _PathArcToFastEx(center, radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+        const int a_step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(radius), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4);
+        if (Flags & ImDrawListFlags_AntiAliasedFill)
+        {
+            _FillShapeTemplate(a_step, 0, &center, &radius, col);
+            return;
+        }
+        _PathArcToFastEx(center, radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, a_step);
         _Path.Size--;
     }
     else
@@ -1623,6 +1959,11 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(center - ImVec2(radius, radius), center + ImVec2(radius, radius)), CalcStrokeCullMargin(this, thickness)))
+    {
+        _CulledVtxCount += CalcPolylineVtxCount(this, num_segments, ImDrawFlags_Closed, thickness);
+        return;
+    }
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1635,6 +1976,11 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(center - ImVec2(radius, radius), center + ImVec2(radius, radius)), CalcFillCullMargin(this)))
+    {
+        _CulledVtxCount += CalcPolyFilledVtxCount(this, num_segments);
+        return;
+    }
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1650,6 +1996,15 @@ void ImDrawList::AddEllipse(const ImVec2& center, const ImVec2& radius, ImU32 co
 
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
+    if (Flags & ImDrawListFlags_CullOffscreen)
+    {
+        const float radius_max = ImMax(ImFabs(radius.x), ImFabs(radius.y));
+        if (IsOutsideClipRect(this, ImRect(center - ImVec2(radius_max, radius_max), center + ImVec2(radius_max, radius_max)), CalcStrokeCullMargin(this, thickness)))
+        {
+            _CulledVtxCount += CalcPolylineVtxCount(this, num_segments, ImDrawFlags_Closed, thickness);
+            return;
+        }
+    }
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = IM_PI * 2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1664,6 +2019,15 @@ void ImDrawList::AddEllipseFilled(const ImVec2& center, const ImVec2& radius, Im
 
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
+    if (Flags & ImDrawListFlags_CullOffscreen)
+    {
+        const float radius_max = ImMax(ImFabs(radius.x), ImFabs(radius.y));
+        if (IsOutsideClipRect(this, ImRect(center - ImVec2(radius_max, radius_max), center + ImVec2(radius_max, radius_max)), CalcFillCullMargin(this)))
+        {
+            _CulledVtxCount += CalcPolyFilledVtxCount(this, num_segments);
+            return;
+        }
+    }
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = IM_PI * 2.0f * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1729,6 +2093,11 @@ void ImDrawList::AddImage(ImTextureRef tex_ref, const ImVec2& p_min, const ImVec
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, ImRect(ImMin(p_min, p_max), ImMax(p_min, p_max)), 0.0f))
+    {
+        _CulledVtxCount += 4;
+        return;
+    }
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
@@ -1745,6 +2114,16 @@ void ImDrawList::AddImageQuad(ImTextureRef tex_ref, const ImVec2& p1, const ImVe
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (Flags & ImDrawListFlags_CullOffscreen)
+    {
+        ImRect bb(p1, p1);
+        bb.Add(p2); bb.Add(p3); bb.Add(p4);
+        if (IsOutsideClipRect(this, bb, 0.0f))
+        {
+            _CulledVtxCount += 4;
+            return;
+        }
+    }
 
     const bool push_texture_id = tex_ref != _CmdHeader.TexRef;
     if (push_texture_id)
@@ -2008,6 +2387,11 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullOffscreen) && IsOutsideClipRect(this, CalcPointsBoundingBox(points, points_count), CalcFillCullMargin(this)))
+    {
+        _CulledVtxCount += CalcPolyFilledVtxCount(this, points_count);
+        return;
+    }
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     ImTriangulator triangulator;
@@ -2153,52 +2537,57 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes. Command count is an upper bound as some commands may be merged below.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    const int cmd_buffer_base = draw_list->CmdBuffer.Size;
+    draw_list->CmdBuffer.resize(cmd_buffer_base + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Fix the incorrect IdxOffset values in each command as we write them, in a single pass over each channel.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + cmd_buffer_base;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawCmd* last_cmd = (cmd_buffer_base > 0) ? cmd_write - 1 : NULL;
+    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const ImDrawCmd* cmd_read = ch._CmdBuffer.Data;
+        const ImDrawCmd* cmd_read_end = ch._CmdBuffer.Data + ch._CmdBuffer.Size;
+        if (cmd_read < cmd_read_end && last_cmd != NULL)
+        {
+            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+            if (ImDrawCmd_HeaderCompare(last_cmd, cmd_read) == 0 && last_cmd->UserCallback == NULL && cmd_read->UserCallback == NULL)
+            {
+                // Merge previous channel last draw command with current channel first draw command if matching (by skipping it, instead of erasing it from the channel).
+                last_cmd->ElemCount += cmd_read->ElemCount;
+                idx_offset += cmd_read->ElemCount;
+                cmd_read++;
+            }
+        }
+        if (int sz = (int)(cmd_read_end - cmd_read))
+        {
+            memcpy(cmd_write, cmd_read, sz * sizeof(ImDrawCmd));
+            for (ImDrawCmd* cmd_write_end = cmd_write + sz; cmd_write < cmd_write_end; cmd_write++)
+            {
+                cmd_write->IdxOffset = idx_offset;
+                idx_offset += cmd_write->ElemCount;
+            }
+            last_cmd = cmd_write - 1;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
+    draw_list->CmdBuffer.Size = (int)(cmd_write - draw_list->CmdBuffer.Data);
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -2340,6 +2729,13 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
 
+// SIMD versions process 4 vertices at a time, using the exact same sequence of float operations as the scalar
+// loops (no FMA, no reciprocal approximation) so the output is bit-identical. ImDrawVert is an array of structures
+// (and its layout may be overridden), so positions are gathered and results are written back per vertex.
+#ifdef IMGUI_ENABLE_SSE2
+#define IM_SHADEVERTS_LOAD_X4(_V, _FIELD)    _mm_setr_ps((_V)[0]._FIELD, (_V)[1]._FIELD, (_V)[2]._FIELD, (_V)[3]._FIELD)
+#endif
+
 // Generic linear color gradient, write to RGB fields, leave A untouched.
 void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
 {
@@ -2353,7 +2749,33 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
     const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
-    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    ImDrawVert* vert = vert_start;
+#ifdef IMGUI_ENABLE_SSE2
+    {
+        const __m128 p0_x = _mm_set1_ps(gradient_p0.x), p0_y = _mm_set1_ps(gradient_p0.y);
+        const __m128 extent_x = _mm_set1_ps(gradient_extent.x), extent_y = _mm_set1_ps(gradient_extent.y);
+        const __m128 inv_length2 = _mm_set1_ps(gradient_inv_length2);
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+        const __m128 c0_r = _mm_set1_ps((float)col0_r), c0_g = _mm_set1_ps((float)col0_g), c0_b = _mm_set1_ps((float)col0_b);
+        const __m128 cd_r = _mm_set1_ps((float)col_delta_r), cd_g = _mm_set1_ps((float)col_delta_g), cd_b = _mm_set1_ps((float)col_delta_b);
+        for (; vert + 4 <= vert_end; vert += 4)
+        {
+            const __m128 dx = _mm_sub_ps(IM_SHADEVERTS_LOAD_X4(vert, pos.x), p0_x);
+            const __m128 dy = _mm_sub_ps(IM_SHADEVERTS_LOAD_X4(vert, pos.y), p0_y);
+            const __m128 d = _mm_add_ps(_mm_mul_ps(dx, extent_x), _mm_mul_ps(dy, extent_y));
+            const __m128 t = _mm_min_ps(one, _mm_max_ps(zero, _mm_mul_ps(d, inv_length2)));
+            const __m128i r = _mm_cvttps_epi32(_mm_add_ps(c0_r, _mm_mul_ps(cd_r, t)));
+            const __m128i g = _mm_cvttps_epi32(_mm_add_ps(c0_g, _mm_mul_ps(cd_g, t)));
+            const __m128i b = _mm_cvttps_epi32(_mm_add_ps(c0_b, _mm_mul_ps(cd_b, t)));
+            const __m128i rgb = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, IM_COL32_R_SHIFT), _mm_slli_epi32(g, IM_COL32_G_SHIFT)), _mm_slli_epi32(b, IM_COL32_B_SHIFT));
+            ImU32 rgb_out[4];
+            _mm_storeu_si128((__m128i*)(void*)rgb_out, rgb);
+            for (int n = 0; n < 4; n++)
+                vert[n].col = rgb_out[n] | (vert[n].col & IM_COL32_A_MASK);
+        }
+    }
+#endif
+    for (; vert < vert_end; vert++)
     {
         float d = ImDot(vert->pos - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
@@ -2375,16 +2797,41 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
 
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    const ImVec2 min = ImMin(uv_a, uv_b);
+    const ImVec2 max = ImMax(uv_a, uv_b);
+    ImDrawVert* vertex = vert_start;
+#ifdef IMGUI_ENABLE_SSE2
+    {
+        const __m128 a_x = _mm_set1_ps(a.x), a_y = _mm_set1_ps(a.y);
+        const __m128 uv_a_x = _mm_set1_ps(uv_a.x), uv_a_y = _mm_set1_ps(uv_a.y);
+        const __m128 scale_x = _mm_set1_ps(scale.x), scale_y = _mm_set1_ps(scale.y);
+        const __m128 min_x = _mm_set1_ps(min.x), min_y = _mm_set1_ps(min.y);
+        const __m128 max_x = _mm_set1_ps(max.x), max_y = _mm_set1_ps(max.y);
+        for (; vertex + 4 <= vert_end; vertex += 4)
+        {
+            __m128 u = _mm_add_ps(uv_a_x, _mm_mul_ps(_mm_sub_ps(IM_SHADEVERTS_LOAD_X4(vertex, pos.x), a_x), scale_x));
+            __m128 v = _mm_add_ps(uv_a_y, _mm_mul_ps(_mm_sub_ps(IM_SHADEVERTS_LOAD_X4(vertex, pos.y), a_y), scale_y));
+            if (clamp)
+            {
+                u = _mm_min_ps(max_x, _mm_max_ps(min_x, u)); // Same as ImClamp(), including for -0.0f and NaN
+                v = _mm_min_ps(max_y, _mm_max_ps(min_y, v));
+            }
+            float u_out[4], v_out[4];
+            _mm_storeu_ps(u_out, u);
+            _mm_storeu_ps(v_out, v);
+            for (int n = 0; n < 4; n++)
+                vertex[n].uv = ImVec2(u_out[n], v_out[n]);
+        }
+    }
+#endif
     if (clamp)
     {
-        const ImVec2 min = ImMin(uv_a, uv_b);
-        const ImVec2 max = ImMax(uv_a, uv_b);
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
     }
     else
     {
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
     }
 }
@@ -2393,7 +2840,27 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
 {
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
-    for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+    ImDrawVert* vertex = vert_start;
+#ifdef IMGUI_ENABLE_SSE2
+    {
+        const __m128 pivot_in_x = _mm_set1_ps(pivot_in.x), pivot_in_y = _mm_set1_ps(pivot_in.y);
+        const __m128 pivot_out_x = _mm_set1_ps(pivot_out.x), pivot_out_y = _mm_set1_ps(pivot_out.y);
+        const __m128 cos4 = _mm_set1_ps(cos_a), sin4 = _mm_set1_ps(sin_a);
+        for (; vertex + 4 <= vert_end; vertex += 4)
+        {
+            const __m128 x = _mm_sub_ps(IM_SHADEVERTS_LOAD_X4(vertex, pos.x), pivot_in_x);
+            const __m128 y = _mm_sub_ps(IM_SHADEVERTS_LOAD_X4(vertex, pos.y), pivot_in_y);
+            const __m128 rx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(x, cos4), _mm_mul_ps(y, sin4)), pivot_out_x);
+            const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, sin4), _mm_mul_ps(y, cos4)), pivot_out_y);
+            float x_out[4], y_out[4];
+            _mm_storeu_ps(x_out, rx);
+            _mm_storeu_ps(y_out, ry);
+            for (int n = 0; n < 4; n++)
+                vertex[n].pos = ImVec2(x_out[n], y_out[n]);
+        }
+    }
+#endif
+    for (; vertex < vert_end; ++vertex)
         vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
 }
 
@@ -2540,6 +3007,14 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasUpdateDrawListsTextures()
 // - ImFontAtlasUpdateDrawListsSharedData()
 //-----------------------------------------------------------------------------
+// - ImFontAtlasSharedCreate()
+// - ImFontAtlasSharedRetire()
+// - ImFontAtlasSharedReclaim()
+// - ImFontAtlasSharedNewFrame()
+// - ImFontAtlasSharedEndFrame()
+// - ImFontAtlasSharedUpdateDrawDataTextures()
+// - ImFontAtlasSharedRemoveUser()
+//-----------------------------------------------------------------------------
 // - ImFontAtlasBuildSetTexture()
 // - ImFontAtlasBuildAddTexture()
 // - ImFontAtlasBuildMakeSpace()
@@ -2558,7 +3033,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasPackAddRect()
 // - ImFontAtlasPackGetRect()
 //-----------------------------------------------------------------------------
-// - ImFontBaked_BuildGrowIndex()
+// - ImFontBaked_BuildGetIndexPage()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
@@ -2642,6 +3117,14 @@ ImFontAtlas::~ImFontAtlas()
     RendererHasTextures = false; // Full Clear() is supported, but ClearTexData() only isn't.
     ClearFonts();
     ClearTexData();
+    if (ImFontAtlasSharedData* shared = SharedData)
+    {
+        ImFontAtlasSharedReclaim(this, true);
+        while (shared->Users.Size > 0)
+            ImFontAtlasSharedRemoveUser(this, shared->Users[0]->DrawListSharedData);
+        IM_DELETE(shared);
+        SharedData = NULL;
+    }
     TexList.clear_delete();
     TexData = NULL;
 }
@@ -2730,6 +3213,9 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
 void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
 {
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
+    if (atlas->LockFn != NULL && atlas->SharedData == NULL)
+        ImFontAtlasSharedCreate(atlas);
+    ImFontAtlasSharedLock(atlas);
     atlas->RendererHasTextures = renderer_has_textures;
 
     // Check that font atlas was built or backend support texture reload in which case we can build now
@@ -2751,10 +3237,11 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     ImFontAtlasBuilder* builder = atlas->Builder;
     builder->FrameCount = frame_count;
     for (ImFont* font : atlas->Fonts)
-        font->LastBaked = NULL;
+        ImAtomicStoreRelease(&font->LastBaked, (ImFontBaked*)NULL);
 
     // Garbage collect BakedPool
-    if (builder->BakedDiscardedCount > 0)
+    // (when atlas is shared, other threads may hold pointers into it: discarded bakes are recycled by ImFontAtlasSharedReclaim() instead)
+    if (builder->BakedDiscardedCount > 0 && atlas->SharedData == NULL)
     {
         int dst_n = 0, src_n = 0;
         for (; src_n < builder->BakedPool.Size; src_n++)
@@ -2821,6 +3308,7 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+    ImFontAtlasSharedUnlock(atlas);
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -2838,7 +3326,23 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
         {
             const ImU8* src_p = (const ImU8*)src_pixels;
             ImU32* dst_p = (ImU32*)(void*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
+            int nx = w;
+#ifdef IMGUI_ENABLE_SSE2
+            // 16 pixels per iteration: zero-extend alpha bytes to 32-bit, shift into place, add white
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i white = _mm_set1_epi32((int)IM_COL32(255, 255, 255, 0));
+            for (; nx >= 16; nx -= 16, src_p += 16, dst_p += 16)
+            {
+                const __m128i a8 = _mm_loadu_si128((const __m128i*)(const void*)src_p);
+                const __m128i a16_lo = _mm_unpacklo_epi8(a8, zero);
+                const __m128i a16_hi = _mm_unpackhi_epi8(a8, zero);
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 0),  _mm_or_si128(_mm_slli_epi32(_mm_unpacklo_epi16(a16_lo, zero), IM_COL32_A_SHIFT), white));
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 4),  _mm_or_si128(_mm_slli_epi32(_mm_unpackhi_epi16(a16_lo, zero), IM_COL32_A_SHIFT), white));
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 8),  _mm_or_si128(_mm_slli_epi32(_mm_unpacklo_epi16(a16_hi, zero), IM_COL32_A_SHIFT), white));
+                _mm_storeu_si128((__m128i*)(void*)(dst_p + 12), _mm_or_si128(_mm_slli_epi32(_mm_unpackhi_epi16(a16_hi, zero), IM_COL32_A_SHIFT), white));
+            }
+#endif
+            for (; nx > 0; nx--)
                 *dst_p++ = IM_COL32(255, 255, 255, (unsigned int)(*src_p++));
         }
     }
@@ -2848,7 +3352,20 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
         {
             const ImU32* src_p = (const ImU32*)(void*)src_pixels;
             ImU8* dst_p = (ImU8*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
+            int nx = w;
+#ifdef IMGUI_ENABLE_SSE2
+            // 16 pixels per iteration: extract alpha to 32-bit lanes, then pack down to bytes (values are 0..255 so saturation is a no-op)
+            const __m128i mask = _mm_set1_epi32(0xFF);
+            for (; nx >= 16; nx -= 16, src_p += 16, dst_p += 16)
+            {
+                const __m128i a0 = _mm_and_si128(_mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 0)), IM_COL32_A_SHIFT), mask);
+                const __m128i a1 = _mm_and_si128(_mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 4)), IM_COL32_A_SHIFT), mask);
+                const __m128i a2 = _mm_and_si128(_mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 8)), IM_COL32_A_SHIFT), mask);
+                const __m128i a3 = _mm_and_si128(_mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src_p + 12)), IM_COL32_A_SHIFT), mask);
+                _mm_storeu_si128((__m128i*)(void*)dst_p, _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3)));
+            }
+#endif
+            for (; nx > 0; nx--)
                 *dst_p++ = ((*src_p++) >> IM_COL32_A_SHIFT) & 0xFF;
         }
     }
@@ -2960,6 +3477,13 @@ void ImFontAtlasTextureBlockQueueUpload(ImFontAtlas* atlas, ImTextureData* tex,
         tex->Status = ImTextureStatus_WantUpdates;
         tex->Updates.push_back(req);
     }
+
+    // Shared atlas: forward to per-context copies, which are updated by ImFontAtlasSharedEndFrame()
+    if (ImFontAtlasSharedData* shared = atlas->SharedData)
+        for (ImFontAtlasSharedUser* user : shared->Users)
+            for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+                if (shared_tex.Source == tex)
+                    shared_tex.PendingUpdates.push_back(req);
 }
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
@@ -3589,6 +4113,7 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
     font->ClearOutputData();
+    ImFontAtlasSharedReclaim(atlas, true); // Release discarded bakes while their sources are alive
     for (ImFontConfig* src : font->Sources)
     {
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
@@ -3694,8 +4219,8 @@ static void ImFontAtlasBuildSetupFontBakedFallback(ImFontBaked* baked)
         glyph.AdvanceX = space_glyph ? space_glyph->AdvanceX : IM_ROUND(baked->Size * 0.40f);
         fallback_glyph = ImFontAtlasBakedAddFontGlyph(font->ContainerAtlas, baked, NULL, &glyph);
     }
-    baked->FallbackGlyphIndex = baked->Glyphs.index_from_ptr(fallback_glyph); // Storing index avoid need to update pointer on growth and simplify inner loop code
     baked->FallbackAdvanceX = fallback_glyph->AdvanceX;
+    ImAtomicStoreRelease(&baked->FallbackGlyphIndex, baked->Glyphs.index_from_ptr(fallback_glyph)); // Storing index avoid need to update pointer on growth and simplify inner loop code
 }
 
 static void ImFontAtlasBuildSetupFontBakedBlanks(ImFontAtlas* atlas, ImFontBaked* baked)
@@ -3762,14 +4287,29 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_ASSERT(font->FallbackChar != c && font->EllipsisChar != c); // Unsupported for simplicity
     IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
     IM_UNUSED(font);
-    baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
-    baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    ImFontBakedIndexPage* page = baked->GetIndexPage(c);
+    ImAtomicStoreRelease(&page->Lookup[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], IM_FONTGLYPH_INDEX_UNUSED);
+    ImAtomicStoreRelaxed(&page->AdvanceX[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], baked->FallbackAdvanceX);
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
 {
     IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
-    ImFontBaked* baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
+    ImFontBaked* baked;
+    ImFontAtlasSharedData* shared = atlas->SharedData;
+    if (shared != NULL && shared->BakedFreeList.Size > 0)
+    {
+        baked = shared->BakedFreeList.back();
+        shared->BakedFreeList.pop_back();
+        atlas->Builder->BakedDiscardedCount--;
+        IM_PLACEMENT_NEW(baked) ImFontBaked();
+    }
+    else
+    {
+        baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
+    }
+    if (shared != NULL)
+        baked->IndexPages.resize((IM_UNICODE_CODEPOINT_MAX >> IM_FONTBAKED_INDEX_PAGE_BITS) + 1, NULL); // Never resized while shared, as readers don't lock.
     baked->Size = font_size;
     baked->RasterizerDensity = font_rasterizer_density;
     baked->BakedId = baked_id;
@@ -3826,11 +4366,9 @@ ImFontBaked* ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, f
     return NULL;
 }
 
-void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
+// Release glyphs, packed rectangles and loader data of a discarded baked size.
+static void ImFontAtlasBakedRelease(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
 {
-    ImFontAtlasBuilder* builder = atlas->Builder;
-    IMGUI_DEBUG_LOG_FONT("[font] Discard baked %.2f for \"%s\"\n", baked->Size, font->GetDebugName());
-
     for (ImFontGlyph& glyph : baked->Glyphs)
         if (glyph.PackId != ImFontAtlasRectId_Invalid)
             ImFontAtlasPackDiscardRect(atlas, glyph.PackId);
@@ -3848,11 +4386,29 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
         IM_FREE(baked->FontLoaderDatas);
         baked->FontLoaderDatas = NULL;
     }
+    baked->ClearOutputData();
+}
+
+void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IMGUI_DEBUG_LOG_FONT("[font] Discard baked %.2f for \"%s\"\n", baked->Size, font->GetDebugName());
+
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
-    baked->ClearOutputData();
     baked->WantDestroy = true;
-    font->LastBaked = NULL;
+    ImAtomicStoreRelease(&font->LastBaked, (ImFontBaked*)NULL);
+    if (ImFontAtlasSharedData* shared = atlas->SharedData)
+    {
+        // Other threads may still be using it during their current frame: they will invalidate their caches on their next frame.
+        shared->BakedDiscardCount++;
+        ImFontAtlasSharedRetire(atlas, NULL, NULL, baked);
+        return;
+    }
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        if (ImGuiContext* ctx = shared_data->Context)
+            ctx->LabelSizeCacheGeneration++; // Baked pointers may be reused or moved by BakedPool compaction
+    ImFontAtlasBakedRelease(atlas, font, baked);
 }
 
 // use unused_frames==0 to discard everything.
@@ -3888,20 +4444,44 @@ void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
 // Those functions are designed to facilitate changing the underlying structures for ImFontAtlas to store an array of ImDrawListSharedData*
 void ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data)
 {
+    if (atlas->LockFn != NULL && atlas->SharedData == NULL)
+        ImFontAtlasSharedCreate(atlas);
+    ImFontAtlasSharedLock(atlas);
     IM_ASSERT(!atlas->DrawListSharedDatas.contains(data));
     atlas->DrawListSharedDatas.push_back(data);
+    ImFontAtlasSharedUnlock(atlas);
 }
 
 void ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data)
 {
+    ImFontAtlasSharedLock(atlas);
     IM_ASSERT(atlas->DrawListSharedDatas.contains(data));
     atlas->DrawListSharedDatas.find_erase(data);
+    if (atlas->SharedData != NULL)
+        ImFontAtlasSharedRemoveUser(atlas, data);
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+// Shared atlas: other threads may repack the texture at any time, so contexts never read texture fields of the atlas without holding the lock.
+// Instead they use copies in their ImDrawListSharedData, taken while holding the lock: on NewFrame() and when they modify the atlas themselves.
+static void ImFontAtlasSharedCopyTexData(ImFontAtlas* atlas, ImDrawListSharedData* data)
+{
+    data->FontAtlasTexRef = atlas->TexRef;
+    data->TexUvWhitePixel = atlas->TexUvWhitePixel;
+    memcpy(data->TexUvLinesCopy, atlas->TexUvLines, sizeof(data->TexUvLinesCopy));
+    data->TexUvLines = data->TexUvLinesCopy;
 }
 
 // Update texture identifier in all active draw lists
+// When atlas is shared, draw lists of other contexts belong to other threads: their draw data is remapped by ImFontAtlasSharedUpdateDrawDataTextures().
 void ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex)
 {
     for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+    {
+        if (atlas->SharedData != NULL && shared_data->Context != GImGui)
+            continue;
+        if (atlas->SharedData != NULL && shared_data->FontAtlasTexRef == old_tex)
+            shared_data->FontAtlasTexRef = new_tex;
         for (ImDrawList* draw_list : shared_data->DrawLists)
         {
             // Replace in command-buffer
@@ -3915,18 +4495,357 @@ void ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex
                 if (stacked_tex == old_tex)
                     stacked_tex = new_tex;
         }
+    }
 }
 
 // Update texture coordinates in all draw list shared context
 // FIXME-NEWATLAS FIXME-OPT: Doesn't seem necessary to update for all, only one bound to current context?
 void ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas)
 {
+    ImFontAtlasSharedLock(atlas);
     for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
-        if (shared_data->FontAtlas == atlas)
+    {
+        // Shared atlas: other contexts write their FontAtlas from their own thread, don't read it. They are updated by ImFontAtlasSharedNewFrame().
+        if (atlas->SharedData != NULL && shared_data->Context != GImGui)
+            continue;
+        if (shared_data->FontAtlas != atlas)
+            continue;
+        if (atlas->SharedData != NULL)
         {
-            shared_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
-            shared_data->TexUvLines = atlas->TexUvLines;
+            ImFontAtlasSharedCopyTexData(atlas, shared_data);
+            continue;
         }
+        shared_data->TexUvWhitePixel = atlas->TexUvWhitePixel;
+        shared_data->TexUvLines = atlas->TexUvLines;
+    }
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+// Current texture of the atlas.
+// Shared atlas: other threads may change it at any time. Use the copy of the current context when available, otherwise read it while holding the lock.
+ImTextureRef ImFontAtlasGetTexRef(ImFontAtlas* atlas, ImDrawListSharedData* data)
+{
+    if (atlas->SharedData == NULL)
+        return atlas->TexRef;
+    if (data != NULL && data->FontAtlas == atlas)
+        return data->FontAtlasTexRef;
+    ImFontAtlasSharedLock(atlas);
+    ImTextureRef tex_ref = atlas->TexRef;
+    ImFontAtlasSharedUnlock(atlas);
+    return tex_ref;
+}
+
+// Enable sharing between threads. Called when ImFontAtlas::LockFn is found set.
+void ImFontAtlasSharedCreate(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->LockFn != NULL && atlas->UnlockFn != NULL && atlas->SharedData == NULL);
+    ImFontAtlasSharedLock(atlas);
+    atlas->SharedData = IM_NEW(ImFontAtlasSharedData)();
+    if (ImFontAtlasBuilder* builder = atlas->Builder)
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+            builder->BakedPool[baked_n].IndexPages.resize((IM_UNICODE_CODEPOINT_MAX >> IM_FONTBAKED_INDEX_PAGE_BITS) + 1, NULL);
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+// Queue data to be freed once no context may be using it anymore. One of 'alloc', 'tex', 'baked' is set.
+void ImFontAtlasSharedRetire(ImFontAtlas* atlas, void* alloc, ImTextureData* tex, ImFontBaked* baked)
+{
+    ImFontAtlasSharedData* shared = atlas->SharedData;
+    ImFontAtlasSharedRetired retired;
+    retired.Epoch = ++shared->Epoch;
+    retired.Alloc = alloc;
+    retired.Tex = tex;
+    retired.Baked = baked;
+    shared->Retired.push_back(retired);
+}
+
+// Glyphs are read by other threads without holding the lock, so they are never modified in place: modify a copy, then publish it.
+static ImFontGlyph* ImFontAtlasSharedCopyGlyphsData(ImFontBaked* baked, int new_capacity)
+{
+    IM_ASSERT(new_capacity >= baked->Glyphs.Size);
+    ImFontGlyph* new_data = (ImFontGlyph*)IM_ALLOC((size_t)new_capacity * sizeof(ImFontGlyph));
+    if (baked->Glyphs.Data)
+        memcpy(new_data, baked->Glyphs.Data, (size_t)baked->Glyphs.Size * sizeof(ImFontGlyph));
+    return new_data;
+}
+
+static void ImFontAtlasSharedSetGlyphsData(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* new_data, int new_capacity)
+{
+    ImFontGlyph* old_data = baked->Glyphs.Data;
+    ImAtomicStoreRelease(&baked->Glyphs.Data, new_data);
+    baked->Glyphs.Capacity = new_capacity;
+    if (old_data)
+        ImFontAtlasSharedRetire(atlas, old_data, NULL, NULL);
+}
+
+// Free retired data which every context has stopped using by starting a new frame.
+// Use 'force = true' when no context is using the atlas (e.g. before destroying fonts).
+void ImFontAtlasSharedReclaim(ImFontAtlas* atlas, bool force)
+{
+    ImFontAtlasSharedData* shared = atlas->SharedData;
+    if (shared == NULL)
+        return;
+    ImFontAtlasSharedLock(atlas);
+    int min_epoch = INT_MAX;
+    if (!force)
+        for (ImFontAtlasSharedUser* user : shared->Users)
+            min_epoch = ImMin(min_epoch, user->Epoch);
+    int dst_n = 0;
+    for (int src_n = 0; src_n < shared->Retired.Size; src_n++)
+    {
+        ImFontAtlasSharedRetired& retired = shared->Retired[src_n];
+        if (retired.Epoch > min_epoch)
+        {
+            shared->Retired[dst_n++] = retired;
+            continue;
+        }
+        if (retired.Alloc)
+            IM_FREE(retired.Alloc);
+        if (ImTextureData* tex = retired.Tex)
+        {
+            for (ImFontAtlasSharedUser* user : shared->Users)
+                for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+                    if (shared_tex.Source == tex)
+                    {
+                        shared_tex.Source = NULL;
+                        shared_tex.Copy->Pixels = NULL;
+                    }
+            IM_DELETE(tex);
+        }
+        if (ImFontBaked* baked = retired.Baked)
+        {
+            ImFontAtlasBakedRelease(atlas, baked->ContainerFont, baked);
+            shared->BakedFreeList.push_back(baked);
+        }
+    }
+    shared->Retired.Size = dst_n;
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+static ImFontAtlasSharedUser* ImFontAtlasSharedFindUser(ImFontAtlas* atlas, ImDrawListSharedData* data)
+{
+    for (ImFontAtlasSharedUser* user : atlas->SharedData->Users)
+        if (user->DrawListSharedData == data)
+            return user;
+    return NULL;
+}
+
+// Called by NewFrame() of every context using a shared atlas, after ImFontAtlasUpdateNewFrame() for the owner context.
+void ImFontAtlasSharedNewFrame(ImFontAtlas* atlas, ImDrawListSharedData* data)
+{
+    if (atlas->SharedData == NULL)
+        ImFontAtlasSharedCreate(atlas);
+    IM_ASSERT(atlas->RendererHasTextures && "Sharing a ImFontAtlas between threads requires ImGuiBackendFlags_RendererHasTextures!");
+    ImFontAtlasSharedLock(atlas);
+    ImFontAtlasSharedData* shared = atlas->SharedData;
+    ImFontAtlasSharedUser* user = ImFontAtlasSharedFindUser(atlas, data);
+    if (user == NULL)
+    {
+        user = IM_NEW(ImFontAtlasSharedUser)();
+        user->DrawListSharedData = data;
+        user->BakedDiscardCount = shared->BakedDiscardCount;
+        shared->Users.push_back(user);
+    }
+    user->Epoch = shared->Epoch;
+
+    // Sources removed from the atlas will be freed by ImFontAtlasSharedReclaim(): detach our copies now.
+    for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+        if (shared_tex.Source != NULL && !atlas->TexList.contains(shared_tex.Source))
+        {
+            ImTextureData* copy = shared_tex.Copy;
+            shared_tex.Source = NULL;
+            shared_tex.PendingUpdates.clear();
+            copy->Pixels = NULL;
+            copy->WantDestroyNextFrame = true;
+            if (copy->Status == ImTextureStatus_WantUpdates)
+                copy->Status = ImTextureStatus_OK;
+            copy->Updates.clear();
+        }
+
+    // Baked pointers may be reused now that we started a new frame
+    if (user->BakedDiscardCount != shared->BakedDiscardCount)
+    {
+        user->BakedDiscardCount = shared->BakedDiscardCount;
+        if (ImGuiContext* ctx = data->Context)
+            ctx->LabelSizeCacheGeneration++;
+    }
+    if (data->FontAtlas == atlas)
+        ImFontAtlasSharedCopyTexData(atlas, data);
+
+    ImFontAtlasSharedReclaim(atlas, false);
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+static void ImFontAtlasSharedDeleteCopy(ImFontAtlasSharedUser* user, int n)
+{
+    ImTextureData* copy = user->Textures[n].Copy;
+    copy->Pixels = NULL; // Owned by source
+    IM_DELETE(copy);
+    user->Textures[n].PendingUpdates.clear();
+    user->Textures.erase(user->Textures.Data + n);
+}
+
+// Called by EndFrame() of every context using a shared atlas: maintain per-context copies of atlas textures and output them for the renderer backend.
+// This is the equivalent of the texture status update done by ImFontAtlasUpdateNewFrame() for non-shared atlases.
+void ImFontAtlasSharedEndFrame(ImFontAtlas* atlas, ImDrawListSharedData* data, ImVector<ImTextureData*>* out_textures)
+{
+    ImFontAtlasSharedLock(atlas);
+    ImFontAtlasSharedUser* user = ImFontAtlasSharedFindUser(atlas, data);
+    if (user == NULL)
+    {
+        ImFontAtlasSharedUnlock(atlas);
+        return;
+    }
+
+    // Update status of copies
+    for (int n = 0; n < user->Textures.Size; n++)
+    {
+        ImFontAtlasSharedTexture& shared_tex = user->Textures[n];
+        ImTextureData* copy = shared_tex.Copy;
+        if (copy->Status == ImTextureStatus_OK)
+        {
+            copy->Updates.resize(0);
+            copy->UpdateRect.x = copy->UpdateRect.y = (unsigned short)~0;
+            copy->UpdateRect.w = copy->UpdateRect.h = 0;
+        }
+        if (copy->Status == ImTextureStatus_Destroyed)
+        {
+            IM_ASSERT(copy->TexID == ImTextureID_Invalid && copy->BackendUserData == NULL && "Backend set texture Status to Destroyed but did not clear TexID/BackendUserData!");
+            if (copy->WantDestroyNextFrame || shared_tex.Source == NULL)
+            {
+                ImFontAtlasSharedDeleteCopy(user, n--);
+                continue;
+            }
+            copy->Status = ImTextureStatus_WantCreate; // Destroy was done was backend (e.g. freed resources mid-run)
+        }
+        else if (copy->WantDestroyNextFrame && copy->Status != ImTextureStatus_WantDestroy)
+        {
+            copy->Status = ImTextureStatus_WantDestroy;
+        }
+        if (copy->Status == ImTextureStatus_WantDestroy)
+        {
+            copy->UnusedFrames++;
+            if (copy->TexID == ImTextureID_Invalid && copy->BackendUserData == NULL)
+            {
+                ImFontAtlasSharedDeleteCopy(user, n--);
+                continue;
+            }
+        }
+    }
+
+    // Forward updates of sources. Copies of previous textures may still be used during this frame, then are destroyed.
+    ImTextureData* current_copy = NULL;
+    for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+    {
+        ImTextureData* src = shared_tex.Source;
+        ImTextureData* copy = shared_tex.Copy;
+        if (src == NULL || copy->Status == ImTextureStatus_WantDestroy)
+            continue;
+        for (ImTextureRect& r : shared_tex.PendingUpdates)
+            ImFontAtlasTextureBlockQueueUpload(atlas, copy, r.x, r.y, r.w, r.h);
+        shared_tex.PendingUpdates.resize(0);
+        copy->UsedRect = src->UsedRect;
+        copy->UseColors = src->UseColors;
+        if (src == atlas->TexData)
+            current_copy = copy;
+        else
+            copy->WantDestroyNextFrame = true;
+    }
+    if (current_copy == NULL && atlas->TexData != NULL)
+    {
+        ImTextureData* src = atlas->TexData;
+        ImTextureData* copy = IM_NEW(ImTextureData)();
+        copy->UniqueID = src->UniqueID;
+        copy->Format = src->Format;
+        copy->Width = src->Width;
+        copy->Height = src->Height;
+        copy->BytesPerPixel = src->BytesPerPixel;
+        copy->Pixels = src->Pixels;
+        copy->UsedRect = src->UsedRect;
+        copy->UseColors = src->UseColors;
+        copy->Status = ImTextureStatus_WantCreate;
+        ImFontAtlasSharedTexture shared_tex;
+        shared_tex.Source = src;
+        shared_tex.Copy = copy;
+        user->Textures.push_back(shared_tex);
+    }
+
+    // Each renderer backend owns its copies
+    for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+    {
+        shared_tex.Copy->RefCount = 1;
+        out_textures->push_back(shared_tex.Copy);
+    }
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+// Called by Render() of every context using a shared atlas: make draw commands refer to our copies of atlas textures.
+// Textures created then removed by other threads since our last EndFrame() have no copy: they are replaced by our most recent copy.
+void ImFontAtlasSharedUpdateDrawDataTextures(ImFontAtlas* atlas, ImDrawListSharedData* data, ImDrawData* draw_data)
+{
+    ImFontAtlasSharedLock(atlas);
+    ImFontAtlasSharedUser* user = ImFontAtlasSharedFindUser(atlas, data);
+    ImTextureData* current_copy = (user && user->Textures.Size > 0) ? user->Textures.back().Copy : NULL;
+    if (current_copy == NULL)
+    {
+        ImFontAtlasSharedUnlock(atlas);
+        return;
+    }
+    ImTextureData* last_tex = NULL;
+    ImTextureData* last_remapped_tex = NULL;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+        for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            ImTextureData* tex = cmd.TexRef._TexData;
+            if (tex == NULL)
+                continue;
+            if (tex != last_tex)
+            {
+                last_tex = tex;
+                last_remapped_tex = NULL;
+                for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+                    if (shared_tex.Source == tex || shared_tex.Copy == tex)
+                    {
+                        if (shared_tex.Copy->Status != ImTextureStatus_WantDestroy && shared_tex.Copy->Status != ImTextureStatus_Destroyed)
+                            last_remapped_tex = shared_tex.Copy;
+                        break;
+                    }
+                if (last_remapped_tex == NULL)
+                {
+                    bool is_atlas_tex = atlas->TexList.contains(tex);
+                    for (int n = 0; n < atlas->SharedData->Retired.Size && !is_atlas_tex; n++)
+                        is_atlas_tex = (atlas->SharedData->Retired[n].Tex == tex);
+                    for (ImFontAtlasSharedTexture& shared_tex : user->Textures)
+                        is_atlas_tex |= (shared_tex.Copy == tex);
+                    last_remapped_tex = is_atlas_tex ? current_copy : tex;
+                }
+            }
+            cmd.TexRef._TexData = last_remapped_tex;
+        }
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+void ImFontAtlasSharedRemoveUser(ImFontAtlas* atlas, ImDrawListSharedData* data)
+{
+    ImFontAtlasSharedLock(atlas);
+    ImFontAtlasSharedData* shared = atlas->SharedData;
+    if (ImFontAtlasSharedUser* user = ImFontAtlasSharedFindUser(atlas, data))
+    {
+        while (user->Textures.Size > 0)
+            ImFontAtlasSharedDeleteCopy(user, user->Textures.Size - 1);
+        shared->Users.find_erase(user);
+        IM_DELETE(user);
+    }
+    ImFontAtlasSharedUnlock(atlas);
+}
+
+// Queue texture to be destroyed on next frame. When atlas is shared, it is instead removed right away and freed once other threads stopped using it.
+static void ImFontAtlasTextureQueueDestroy(ImFontAtlas* atlas, ImTextureData* tex)
+{
+    if (atlas->SharedData == NULL)
+        tex->WantDestroyNextFrame = true;
+    else if (atlas->TexList.find_erase(tex))
+        ImFontAtlasSharedRetire(atlas, NULL, tex, NULL);
 }
 
 // Set current texture. This is mostly called from AddTexture() + to handle a failed resize.
@@ -3966,7 +4885,7 @@ ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
     if (old_tex != NULL)
     {
         // Queue old as to destroy next frame
-        old_tex->WantDestroyNextFrame = true;
+        ImFontAtlasTextureQueueDestroy(atlas, old_tex);
         IM_ASSERT(old_tex->Status == ImTextureStatus_OK || old_tex->Status == ImTextureStatus_WantCreate || old_tex->Status == ImTextureStatus_WantUpdates);
     }
 
@@ -4027,7 +4946,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
             // Undo, grow texture and try repacking again.
             // FIXME-NEWATLAS-TESTS: This is a very rarely exercised path! It needs to be automatically tested properly.
             IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: resize failed. Will grow.\n", new_tex->UniqueID);
-            new_tex->WantDestroyNextFrame = true;
+            ImFontAtlasTextureQueueDestroy(atlas, new_tex);
             builder->Rects.swap(old_rects);
             builder->RectsIndex = old_index;
             ImFontAtlasBuildSetTexture(atlas, old_tex);
@@ -4043,8 +4962,16 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     builder->RectsDiscardedSurface = 0;
 
     // Patch glyphs UV
+    // (shared atlas: other threads may be reading glyphs, patch a copy)
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
-        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        ImFontGlyph* glyphs = baked->Glyphs.Data;
+        if (atlas->SharedData != NULL && glyphs != NULL)
+            glyphs = ImFontAtlasSharedCopyGlyphsData(baked, baked->Glyphs.Capacity);
+        for (int glyph_n = 0; glyph_n < baked->Glyphs.Size; glyph_n++)
+        {
+            ImFontGlyph& glyph = glyphs[glyph_n];
             if (glyph.PackId != ImFontAtlasRectId_Invalid)
             {
                 ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
@@ -4053,6 +4980,10 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
                 glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
                 glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
             }
+        }
+        if (glyphs != baked->Glyphs.Data)
+            ImFontAtlasSharedSetGlyphsData(atlas, baked, glyphs, baked->Glyphs.Capacity);
+    }
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
@@ -4227,6 +5158,11 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    if (atlas->SharedData != NULL)
+    {
+        ImFontAtlasSharedReclaim(atlas, true);
+        atlas->SharedData->BakedFreeList.clear();
+    }
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
@@ -4394,13 +5330,22 @@ static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar
     return true;
 }
 
-static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
+// Return index page for a codepoint, allocating it if needed.
+static ImFontBakedIndexPage* ImFontBaked_BuildGetIndexPage(ImFontBaked* baked, unsigned int codepoint)
 {
-    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
-    if (new_size <= baked->IndexLookup.Size)
-        return;
-    baked->IndexAdvanceX.resize(new_size, -1.0f);
-    baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
+    const int page_n = (int)(codepoint >> IM_FONTBAKED_INDEX_PAGE_BITS);
+    if (page_n >= baked->IndexPages.Size)
+        baked->IndexPages.resize(page_n + 1, NULL);
+    ImFontBakedIndexPage* page = baked->IndexPages.Data[page_n];
+    if (page == NULL)
+    {
+        page = (ImFontBakedIndexPage*)IM_ALLOC(sizeof(ImFontBakedIndexPage));
+        for (int n = 0; n < IM_FONTBAKED_INDEX_PAGE_SIZE; n++)
+            page->AdvanceX[n] = -1.0f;
+        memset(page->Lookup, 0xFF, sizeof(page->Lookup)); // IM_FONTGLYPH_INDEX_UNUSED
+        ImAtomicStoreRelease(&baked->IndexPages.Data[page_n], page); // Shared atlas: readers see an initialized page.
+    }
+    return page;
 }
 
 static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
@@ -4410,7 +5355,7 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
         *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
 }
 
-static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
+static ImFontGlyph* ImFontBaked_BuildLoadGlyphNoLock(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
 {
     ImFont* font = baked->ContainerFont;
     ImFontAtlas* atlas = font->ContainerAtlas;
@@ -4475,12 +5420,37 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         ImFontAtlasBuildSetupFontBakedFallback(baked);
 
     // Mark index as not found, so we don't attempt the search twice
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
-    baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    ImFontBakedIndexPage* page = ImFontBaked_BuildGetIndexPage(baked, codepoint);
+    ImAtomicStoreRelaxed(&page->AdvanceX[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], baked->FallbackAdvanceX);
+    ImAtomicStoreRelease(&page->Lookup[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], IM_FONTGLYPH_INDEX_NOT_FOUND); // Shared atlas: readers of Lookup[] see FallbackGlyphIndex.
     return NULL;
 }
 
+static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
+{
+    ImFontAtlas* atlas = baked->ContainerFont->ContainerAtlas;
+    if (atlas->SharedData == NULL)
+        return ImFontBaked_BuildLoadGlyphNoLock(baked, codepoint, only_load_advance_x);
+
+    // Shared atlas: nothing gets written when glyph loading is disabled and the fallback is set up (e.g. PushPasswordFont()), skip the lock.
+    if ((baked->ContainerFont->Flags & ImFontFlags_NoLoadGlyphs) && ImAtomicLoadAcquire(&baked->FallbackGlyphIndex) != -1)
+        return NULL;
+
+    // Shared atlas: another thread may have loaded the glyph while we were waiting for the lock.
+    ImFontAtlasSharedLock(atlas);
+    ImFontGlyph* glyph = NULL;
+    const ImFontBakedIndexPage* page = baked->GetIndexPage(codepoint);
+    const int i = page ? (int)page->Lookup[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)] : IM_FONTGLYPH_INDEX_UNUSED;
+    if (i == IM_FONTGLYPH_INDEX_UNUSED && only_load_advance_x != NULL && page && page->AdvanceX[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)] >= 0.0f)
+        *only_load_advance_x = page->AdvanceX[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)];
+    else if (i == IM_FONTGLYPH_INDEX_UNUSED)
+        glyph = ImFontBaked_BuildLoadGlyphNoLock(baked, codepoint, only_load_advance_x);
+    else if (i != IM_FONTGLYPH_INDEX_NOT_FOUND)
+        glyph = &baked->Glyphs.Data[i];
+    ImFontAtlasSharedUnlock(atlas);
+    return glyph;
+}
+
 static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
 {
     if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE)
@@ -4511,6 +5481,8 @@ void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
     // [DEBUG] Log texture update requests
     ImGuiContext& g = *GImGui;
     IM_UNUSED(g);
+    if (atlas->SharedData != NULL)
+        return; // Backends only see per-context copies of shared atlas textures
     for (ImTextureData* tex : atlas->TexList)
     {
         if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0)
@@ -4542,13 +5514,297 @@ void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
 
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 
+// Scratch memory reused across glyphs.
+// stb_truetype does ~5 malloc/free per rasterized glyph (shape, flattened curves, edges, active edge heap, scanlines):
+// while rasterizing we set stbtt_fontinfo::userdata to this, so they are bump allocated in a buffer which is reset for each glyph.
+// Requests not fitting are forwarded to IM_ALLOC() and the buffer grows to the peak usage for the next glyph.
+struct ImGui_ImplStbTrueType_Scratch
+{
+    ImVector<char>          Buffer;
+    int                     Used;
+    int                     Peak;
+    ImVector<unsigned int>  PrefilterBuffer;
+
+    ImGui_ImplStbTrueType_Scratch() { Used = Peak = 0; }
+    void Reset()                    { if (Peak > Buffer.Size) { Buffer.clear(); Buffer.resize(Peak); } Used = Peak = 0; } // Call when no allocation is alive
+};
+
+#ifdef IMGUI_STB_TRUETYPE_USE_SCRATCH
+static void* ImGui_ImplStbTrueType_ScratchAlloc(size_t size, void* user_data)
+{
+    ImGui_ImplStbTrueType_Scratch* scratch = (ImGui_ImplStbTrueType_Scratch*)user_data;
+    if (scratch == NULL)
+        return IM_ALLOC(size);
+    const int aligned_size = (int)((size + 15) & ~(size_t)15);
+    scratch->Peak += aligned_size;
+    if (scratch->Used + aligned_size > scratch->Buffer.Size)
+        return IM_ALLOC(size);
+    void* ptr = scratch->Buffer.Data + scratch->Used;
+    scratch->Used += aligned_size;
+    return ptr;
+}
+
+static void ImGui_ImplStbTrueType_ScratchFree(void* ptr, void* user_data)
+{
+    ImGui_ImplStbTrueType_Scratch* scratch = (ImGui_ImplStbTrueType_Scratch*)user_data;
+    if (scratch != NULL && ptr >= (void*)scratch->Buffer.Data && ptr < (void*)(scratch->Buffer.Data + scratch->Buffer.Size))
+        return; // Released in bulk by Reset()
+    IM_FREE(ptr);
+}
+#endif
+
+// Box filters for oversampling, equivalent to stbtt__h_prefilter()/stbtt__v_prefilter() (byte-identical output) but cheaper:
+// - Horizontal: sums are computed from a zero-padded copy of the row, without the running ring buffer, so the loop can be vectorized.
+// - Vertical: processes rows in memory order keeping one running sum per column, instead of walking each column with 'stride' steps.
+template<int KERNEL_WIDTH>
+static void ImGui_ImplStbTrueType_PrefilterRowH(unsigned char* pixels, unsigned int* padded_row, int w)
+{
+    for (int i = 0; i < KERNEL_WIDTH - 1; i++)
+        padded_row[i] = 0;
+    for (int i = 0; i < w; i++)
+        padded_row[i + KERNEL_WIDTH - 1] = pixels[i];
+    for (int i = 0; i < w; i++)
+    {
+        unsigned int total = 0;
+        for (int k = 0; k < KERNEL_WIDTH; k++)
+            total += padded_row[i + k];
+        pixels[i] = (unsigned char)(total / KERNEL_WIDTH);
+    }
+}
+
+static void ImGui_ImplStbTrueType_PrefilterH(ImGui_ImplStbTrueType_Scratch* scratch, unsigned char* pixels, int w, int h, int stride, int kernel_width)
+{
+    IM_ASSERT(kernel_width >= 2 && kernel_width <= STBTT_MAX_OVERSAMPLE);
+    scratch->PrefilterBuffer.resize(w + kernel_width);
+    unsigned int* padded_row = scratch->PrefilterBuffer.Data;
+    for (int j = 0; j < h; j++, pixels += stride)
+    {
+        switch (kernel_width)
+        {
+        case 2: ImGui_ImplStbTrueType_PrefilterRowH<2>(pixels, padded_row, w); break;
+        case 3: ImGui_ImplStbTrueType_PrefilterRowH<3>(pixels, padded_row, w); break;
+        case 4: ImGui_ImplStbTrueType_PrefilterRowH<4>(pixels, padded_row, w); break;
+        case 5: ImGui_ImplStbTrueType_PrefilterRowH<5>(pixels, padded_row, w); break;
+        case 6: ImGui_ImplStbTrueType_PrefilterRowH<6>(pixels, padded_row, w); break;
+        case 7: ImGui_ImplStbTrueType_PrefilterRowH<7>(pixels, padded_row, w); break;
+        default: ImGui_ImplStbTrueType_PrefilterRowH<8>(pixels, padded_row, w); break;
+        }
+    }
+}
+
+static void ImGui_ImplStbTrueType_PrefilterV(ImGui_ImplStbTrueType_Scratch* scratch, unsigned char* pixels, int w, int h, int stride, int kernel_width)
+{
+    IM_ASSERT(kernel_width >= 2 && kernel_width <= STBTT_MAX_OVERSAMPLE);
+    // Running sum per column + copy of the last 'kernel_width' source rows (they are overwritten in place)
+    scratch->PrefilterBuffer.resize(w * (1 + kernel_width));
+    memset(scratch->PrefilterBuffer.Data, 0, (size_t)scratch->PrefilterBuffer.size_in_bytes());
+    unsigned int* totals = scratch->PrefilterBuffer.Data;
+    for (int j = 0; j < h; j++, pixels += stride)
+    {
+        unsigned int* history = totals + w * (1 + j % kernel_width);
+        for (int i = 0; i < w; i++)
+        {
+            const unsigned int v = pixels[i];
+            totals[i] += v - history[i];
+            history[i] = v;
+            pixels[i] = (unsigned char)(totals[i] / (unsigned int)kernel_width);
+        }
+    }
+}
+
+#ifndef IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE
+#define IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE     (512 * 1024)
+#endif
+
+// Cache of parsed glyph outlines (stbtt_GetGlyphShape() output, in font units), shared by all baked sizes of a font source.
+// Parsing is independent of size, whereas curve flattening depends on the rasterization scale, so we cache before flattening.
+// Least recently used outlines are evicted when going over IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE bytes.
+struct ImGui_ImplStbTrueType_ShapeCacheEntry
+{
+    int             GlyphIndex;
+    int             VtxCount;
+    stbtt_vertex*   Vtx;            // Allocated with IM_ALLOC()
+    unsigned int    LastUsed;
+};
+
+struct ImGui_ImplStbTrueType_ShapeCache
+{
+    ImVector<ImGui_ImplStbTrueType_ShapeCacheEntry> Entries;
+    ImGuiStorage    Map;            // GlyphIndex -> index in Entries + 1
+    int             SizeInBytes;
+    unsigned int    UseCounter;
+
+    ImGui_ImplStbTrueType_ShapeCache()  { SizeInBytes = 0; UseCounter = 0; }
+    ~ImGui_ImplStbTrueType_ShapeCache() { Clear(); }
+    void Clear()                        { for (ImGui_ImplStbTrueType_ShapeCacheEntry& entry : Entries) IM_FREE(entry.Vtx); Entries.clear(); Map.Clear(); SizeInBytes = 0; }
+};
+
+// Codepoint coverage of a font source, built once from its cmap table and shared by all baked sizes.
+// When merging fonts, selecting the source of a glyph is a bit test per source instead of a cmap search per source.
+// Two-level bitmap: PageMap[c >> 8] is the index of a 256-bit page in Pages[]. Page 0 is empty and shared by all unmapped ranges.
+struct ImGui_ImplStbTrueType_Coverage
+{
+    ImVector<ImU16>     PageMap;        // Empty if cmap format is not supported: use stbtt_FindGlyphIndex() instead.
+    ImVector<ImU32>     Pages;          // 8 x ImU32 per page
+
+    bool    IsValid() const                 { return PageMap.Size != 0; }
+    bool    Contains(unsigned int c) const  { return (c <= IM_UNICODE_CODEPOINT_MAX) && (Pages.Data[(PageMap.Data[c >> 8] << 3) + ((c & 0xFF) >> 5)] & ((ImU32)1 << (c & 31))) != 0; }
+    void    Add(unsigned int c)
+    {
+        if (c > IM_UNICODE_CODEPOINT_MAX)
+            return;
+        ImU16& page_n = PageMap.Data[c >> 8];
+        if (page_n == 0)
+        {
+            page_n = (ImU16)(Pages.Size >> 3);
+            Pages.resize(Pages.Size + 8, 0);
+        }
+        Pages.Data[(page_n << 3) + ((c & 0xFF) >> 5)] |= (ImU32)1 << (c & 31);
+    }
+};
+
+static inline unsigned int ImGui_ImplStbTrueType_ReadU16(const unsigned char* p) { return (p[0] << 8) | p[1]; }
+static inline unsigned int ImGui_ImplStbTrueType_ReadU32(const unsigned char* p) { return ((unsigned int)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+// Enumerate codepoints of the cmap subtable selected by stbtt_InitFont(). Must match stbtt_FindGlyphIndex() != 0.
+static void ImGui_ImplStbTrueType_BuildCoverage(ImGui_ImplStbTrueType_Coverage* coverage, const stbtt_fontinfo* info)
+{
+    const unsigned char* cmap = info->data + info->index_map;
+    const unsigned int format = ImGui_ImplStbTrueType_ReadU16(cmap);
+    if (format != 0 && format != 4 && format != 6 && format != 12 && format != 13)
+        return;
+    coverage->PageMap.resize((IM_UNICODE_CODEPOINT_MAX >> 8) + 1, 0);
+    coverage->Pages.resize(8, 0);
+    if (format == 0)
+    {
+        const unsigned int count = ImGui_ImplStbTrueType_ReadU16(cmap + 2) - 6;
+        for (unsigned int c = 0; c < count && c < 256; c++)
+            if (cmap[6 + c] != 0)
+                coverage->Add(c);
+    }
+    else if (format == 6)
+    {
+        const unsigned int first = ImGui_ImplStbTrueType_ReadU16(cmap + 6);
+        const unsigned int count = ImGui_ImplStbTrueType_ReadU16(cmap + 8);
+        for (unsigned int n = 0; n < count; n++)
+            if (ImGui_ImplStbTrueType_ReadU16(cmap + 10 + n * 2) != 0)
+                coverage->Add(first + n);
+    }
+    else if (format == 4)
+    {
+        // Segments are sorted by end code. Same glyph computation as stbtt_FindGlyphIndex().
+        const unsigned int seg_count = ImGui_ImplStbTrueType_ReadU16(cmap + 6) >> 1;
+        const unsigned char* end_codes = cmap + 14;
+        const unsigned char* start_codes = end_codes + seg_count * 2 + 2;
+        const unsigned char* id_deltas = start_codes + seg_count * 2;
+        const unsigned char* id_range_offsets = id_deltas + seg_count * 2;
+        unsigned int prev_end = 0;
+        for (unsigned int seg_n = 0; seg_n < seg_count; seg_n++)
+        {
+            const unsigned int start = ImGui_ImplStbTrueType_ReadU16(start_codes + seg_n * 2);
+            const unsigned int end = ImGui_ImplStbTrueType_ReadU16(end_codes + seg_n * 2);
+            const unsigned int delta = ImGui_ImplStbTrueType_ReadU16(id_deltas + seg_n * 2);
+            const unsigned int range_offset = ImGui_ImplStbTrueType_ReadU16(id_range_offsets + seg_n * 2);
+            for (unsigned int c = ImMax(start, seg_n > 0 ? prev_end + 1 : 0); c <= end; c++) // Codepoints are searched in the first segment ending after them
+            {
+                const unsigned int glyph_index = (range_offset == 0) ? ((c + delta) & 0xFFFF) : ImGui_ImplStbTrueType_ReadU16(id_range_offsets + seg_n * 2 + range_offset + (c - start) * 2);
+                if (glyph_index != 0)
+                    coverage->Add(c);
+            }
+            prev_end = end;
+        }
+    }
+    else if (format == 12 || format == 13)
+    {
+        const unsigned int groups_count = ImGui_ImplStbTrueType_ReadU32(cmap + 12);
+        for (unsigned int group_n = 0; group_n < groups_count; group_n++)
+        {
+            const unsigned char* group = cmap + 16 + group_n * 12;
+            const unsigned int start = ImGui_ImplStbTrueType_ReadU32(group);
+            const unsigned int end = ImMin(ImGui_ImplStbTrueType_ReadU32(group + 4), (unsigned int)IM_UNICODE_CODEPOINT_MAX);
+            const unsigned int start_glyph = ImGui_ImplStbTrueType_ReadU32(group + 8);
+            for (unsigned int c = start; c <= end; c++)
+                if ((format == 12) ? (start_glyph + (c - start) != 0) : (start_glyph != 0))
+                    coverage->Add(c);
+        }
+    }
+}
+
 // One for each ConfigData
 struct ImGui_ImplStbTrueType_FontSrcData
 {
-    stbtt_fontinfo  FontInfo;
-    float           ScaleFactor;
+    stbtt_fontinfo                      FontInfo;
+    float                               ScaleFactor;
+    ImGui_ImplStbTrueType_Coverage      Coverage;
+    ImGui_ImplStbTrueType_Scratch       Scratch;
+    ImGui_ImplStbTrueType_ShapeCache    ShapeCache;
 };
 
+static int IMGUI_CDECL ImGui_ImplStbTrueType_ShapeCacheEntryComparerByLastUsed(const void* lhs, const void* rhs)
+{
+    const unsigned int a = ((const ImGui_ImplStbTrueType_ShapeCacheEntry*)lhs)->LastUsed;
+    const unsigned int b = ((const ImGui_ImplStbTrueType_ShapeCacheEntry*)rhs)->LastUsed;
+    return (a > b) ? -1 : (a < b) ? +1 : 0; // Most recently used first
+}
+
+static void ImGui_ImplStbTrueType_ShapeCacheTrim(ImGui_ImplStbTrueType_ShapeCache* cache, int target_size)
+{
+    // Evict least recently used entries
+    ImVector<ImGui_ImplStbTrueType_ShapeCacheEntry> entries;
+    entries.swap(cache->Entries);
+    ImQsort(entries.Data, (size_t)entries.Size, sizeof(entries[0]), ImGui_ImplStbTrueType_ShapeCacheEntryComparerByLastUsed);
+    cache->Map.Clear();
+    cache->SizeInBytes = 0;
+    for (ImGui_ImplStbTrueType_ShapeCacheEntry& entry : entries)
+    {
+        const int entry_size = entry.VtxCount * (int)sizeof(stbtt_vertex);
+        if (cache->SizeInBytes + entry_size > target_size)
+        {
+            IM_FREE(entry.Vtx);
+            continue;
+        }
+        cache->Entries.push_back(entry);
+        cache->Map.SetInt((ImGuiID)entry.GlyphIndex, cache->Entries.Size);
+        cache->SizeInBytes += entry_size;
+    }
+}
+
+// Return outline of a glyph. If '*out_owned' is set the caller needs to IM_FREE() the returned vertices.
+static int ImGui_ImplStbTrueType_GetGlyphShape(ImGui_ImplStbTrueType_FontSrcData* bd_font_data, int glyph_index, stbtt_vertex** out_vertices, bool* out_owned)
+{
+    ImGui_ImplStbTrueType_ShapeCache* cache = &bd_font_data->ShapeCache;
+    if (int entry_idx = cache->Map.GetInt((ImGuiID)glyph_index, 0))
+    {
+        ImGui_ImplStbTrueType_ShapeCacheEntry& entry = cache->Entries[entry_idx - 1];
+        entry.LastUsed = ++cache->UseCounter;
+        *out_vertices = entry.Vtx;
+        *out_owned = false;
+        return entry.VtxCount;
+    }
+
+    IM_ASSERT(bd_font_data->FontInfo.userdata == NULL); // Must not be allocated from scratch memory
+    stbtt_vertex* vertices = NULL;
+    const int vtx_count = stbtt_GetGlyphShape(&bd_font_data->FontInfo, glyph_index, &vertices);
+    *out_vertices = vertices;
+    *out_owned = true;
+    const int entry_size = vtx_count * (int)sizeof(stbtt_vertex);
+    if (vertices == NULL || entry_size > IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE / 4)
+        return vtx_count;
+
+    if (cache->SizeInBytes + entry_size > IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE)
+        ImGui_ImplStbTrueType_ShapeCacheTrim(cache, IMGUI_STB_TRUETYPE_SHAPE_CACHE_SIZE * 3 / 4 - entry_size); // Trim more than needed so sorting is amortized
+    ImGui_ImplStbTrueType_ShapeCacheEntry entry;
+    entry.GlyphIndex = glyph_index;
+    entry.VtxCount = vtx_count;
+    entry.Vtx = vertices;
+    entry.LastUsed = ++cache->UseCounter;
+    cache->Entries.push_back(entry);
+    cache->Map.SetInt((ImGuiID)glyph_index, cache->Entries.Size);
+    cache->SizeInBytes += entry_size;
+    *out_owned = false;
+    return vtx_count;
+}
+
 static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig* src)
 {
     IM_UNUSED(atlas);
@@ -4570,6 +5826,8 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->FontInfo.userdata = NULL; // Not set by stbtt_InitFont(), passed to STBTT_malloc()
+    ImGui_ImplStbTrueType_BuildCoverage(&bd_font_data->Coverage, &bd_font_data->FontInfo);
     src->FontLoaderData = bd_font_data;
 
     if (src->MergeMode && src->SizePixels == 0.0f)
@@ -4600,6 +5858,8 @@ static bool ImGui_ImplStbTrueType_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFon
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data != NULL);
 
+    if (bd_font_data->Coverage.IsValid())
+        return bd_font_data->Coverage.Contains(codepoint);
     int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
     return glyph_index != 0;
 }
@@ -4627,6 +5887,8 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data);
+    if (bd_font_data->Coverage.IsValid() && !bd_font_data->Coverage.Contains(codepoint))
+        return false;
     int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
     if (glyph_index == 0)
         return false;
@@ -4679,15 +5941,31 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         builder->TempBuffer.resize(w * h * 1);
         unsigned char* bitmap_pixels = builder->TempBuffer.Data;
         memset(bitmap_pixels, 0, w * h * 1);
-        stbtt_MakeGlyphBitmapSubpixel(&bd_font_data->FontInfo, bitmap_pixels, r->w - oversample_h + 1, r->h - oversample_v + 1, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, glyph_index);
+
+        // Same as stbtt_MakeGlyphBitmapSubpixel(), using cached outline
+        stbtt_vertex* vertices;
+        bool vertices_owned;
+        const int vtx_count = ImGui_ImplStbTrueType_GetGlyphShape(bd_font_data, glyph_index, &vertices, &vertices_owned);
+        stbtt__bitmap gbm;
+        gbm.pixels = bitmap_pixels;
+        gbm.w = r->w - oversample_h + 1;
+        gbm.h = r->h - oversample_v + 1;
+        gbm.stride = w;
+        bd_font_data->Scratch.Reset();
+#ifdef IMGUI_STB_TRUETYPE_USE_SCRATCH
+        bd_font_data->FontInfo.userdata = &bd_font_data->Scratch;
+#endif
+        if (gbm.w && gbm.h)
+            stbtt_Rasterize(&gbm, 0.35f, vertices, vtx_count, scale_for_raster_x, scale_for_raster_y, 0.0f, 0.0f, x0, y0, 1, bd_font_data->FontInfo.userdata);
+        bd_font_data->FontInfo.userdata = NULL;
+        if (vertices_owned)
+            stbtt_FreeShape(&bd_font_data->FontInfo, vertices);
 
         // Oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
         if (oversample_h > 1)
-            stbtt__h_prefilter(bitmap_pixels, r->w, r->h, r->w, oversample_h);
+            ImGui_ImplStbTrueType_PrefilterH(&bd_font_data->Scratch, bitmap_pixels, r->w, r->h, r->w, oversample_h);
         if (oversample_v > 1)
-            stbtt__v_prefilter(bitmap_pixels, r->w, r->h, r->w, oversample_v);
+            ImGui_ImplStbTrueType_PrefilterV(&bd_font_data->Scratch, bitmap_pixels, r->w, r->h, r->w, oversample_v);
 
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -5062,8 +6340,9 @@ void ImFontBaked::ClearOutputData()
 {
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
-    IndexAdvanceX.clear();
-    IndexLookup.clear();
+    for (ImFontBakedIndexPage* page : IndexPages)
+        IM_FREE(page);
+    IndexPages.clear();
     FallbackGlyphIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -5109,10 +6388,16 @@ bool ImFont::IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last)
 // - 'src' is not necessarily == 'this->Sources' because multiple source fonts+configs can be used to build one target font.
 ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph)
 {
+    if (atlas->SharedData != NULL && baked->Glyphs.Size == baked->Glyphs.Capacity)
+    {
+        // Shared atlas: other threads may be reading glyphs without holding the lock. Publish a grown copy and retire the old buffer.
+        const int new_capacity = baked->Glyphs._grow_capacity(baked->Glyphs.Size + 1);
+        ImFontAtlasSharedSetGlyphsData(atlas, baked, ImFontAtlasSharedCopyGlyphsData(baked, new_capacity), new_capacity);
+    }
     int glyph_idx = baked->Glyphs.Size;
     baked->Glyphs.push_back(*in_glyph);
     ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
-    IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
+    IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // ImFontBakedIndexPage::Lookup[] hold 16-bit values and -1/-2 are reserved.
 
     // Set UV from packed rectangle
     if (glyph->PackId != ImFontAtlasRectId_Invalid)
@@ -5151,9 +6436,9 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
-    baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    ImFontBakedIndexPage* page = ImFontBaked_BuildGetIndexPage(baked, codepoint);
+    ImAtomicStoreRelaxed(&page->AdvanceX[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], glyph->AdvanceX);
+    ImAtomicStoreRelease(&page->Lookup[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], (ImU16)glyph_idx); // Shared atlas: readers of Lookup[] see the glyph.
     const int page_n = codepoint / 8192;
     baked->ContainerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5179,8 +6464,7 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
         advance_x += src->GlyphExtraAdvanceX;
     }
 
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = advance_x;
+    ImAtomicStoreRelaxed(&ImFontBaked_BuildGetIndexPage(baked, codepoint)->AdvanceX[codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)], advance_x);
 }
 
 // Copy to texture, post-process and queue update for backend
@@ -5199,43 +6483,54 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
     RemapPairs.SetInt((ImGuiID)from_codepoint, (int)to_codepoint);
 }
 
+// Return index page for a codepoint, NULL if none of its codepoints was looked up yet.
+// Shared atlas: Lookup[], AdvanceX[] and Glyphs.Data are published by other threads, read them with ImAtomicLoadXXX() when not holding the lock.
+ImFontBakedIndexPage* ImFontBaked::GetIndexPage(unsigned int c) const
+{
+    unsigned int page_n = c >> IM_FONTBAKED_INDEX_PAGE_BITS;
+    return (page_n < (unsigned int)IndexPages.Size) ? ImAtomicLoadAcquire(&IndexPages.Data[page_n]) : NULL;
+}
+
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    if (const ImFontBakedIndexPage* page = GetIndexPage(c)) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)ImAtomicLoadAcquire(&page->Lookup[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)]);
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
-            return &Glyphs.Data[FallbackGlyphIndex];
+            return &ImAtomicLoadAcquire(&Glyphs.Data)[FallbackGlyphIndex];
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return &Glyphs.Data[i];
+            return &ImAtomicLoadAcquire(&Glyphs.Data)[i];
     }
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
-    return glyph ? glyph : &Glyphs.Data[FallbackGlyphIndex];
+    return glyph ? glyph : &ImAtomicLoadAcquire(&Glyphs.Data)[ImAtomicLoadAcquire(&FallbackGlyphIndex)];
 }
 
 // Attempt to load but when missing, return NULL instead of FallbackGlyph
 ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    if (const ImFontBakedIndexPage* page = GetIndexPage(c)) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)ImAtomicLoadAcquire(&page->Lookup[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)]);
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return NULL;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return &Glyphs.Data[i];
+            return &ImAtomicLoadAcquire(&Glyphs.Data)[i];
     }
+    ImFontAtlas* atlas = ContainerFont->ContainerAtlas;
+    ImFontAtlasSharedLock(atlas);
     LockLoadingFallback = true; // This is actually a rare call, not done in hot-loop, so we prioritize not adding extra cruft to ImFontBaked_BuildLoadGlyph() call sites.
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     LockLoadingFallback = false;
+    ImFontAtlasSharedUnlock(atlas);
     return glyph;
 }
 
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    if (const ImFontBakedIndexPage* page = GetIndexPage(c)) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)ImAtomicLoadRelaxed(&page->Lookup[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)]);
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return false;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5262,10 +6557,10 @@ bool ImFont::IsGlyphInFont(ImWchar c)
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
-    if ((int)c < IndexAdvanceX.Size)
+    if (const ImFontBakedIndexPage* page = GetIndexPage(c))
     {
         // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
-        const float x = IndexAdvanceX.Data[c];
+        const float x = ImAtomicLoadRelaxed(&page->AdvanceX[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)]);
         if (x >= 0.0f)
             return x;
     }
@@ -5285,24 +6580,28 @@ ImGuiID ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterize
 // ImFontBaked pointers are valid for the entire frame but shall never be kept between frames.
 ImFontBaked* ImFont::GetFontBaked(float size, float density)
 {
-    ImFontBaked* baked = LastBaked;
+    ImFontBaked* baked = ImAtomicLoadAcquire(&LastBaked); // Shared atlas: other threads write it while holding the lock.
 
     // Round font size
     // - ImGui::PushFont() will already round, but other paths calling GetFontBaked() directly also needs it (e.g. ImFontAtlasBuildPreloadAllGlyphRanges)
     size = ImGui::GetRoundedFontSize(size);
 
+    // Shared atlas: CurrentRasterizerDensity is not updated (see UpdateCurrentFontSize()), use the density of the current context.
     if (density < 0.0f)
-        density = CurrentRasterizerDensity;
+        density = (ContainerAtlas->SharedData != NULL && GImGui != NULL) ? GImGui->FontRasterizerDensity : CurrentRasterizerDensity;
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
 
     ImFontAtlas* atlas = ContainerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasSharedLock(atlas);
     baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
-    if (baked == NULL)
-        return NULL;
-    baked->LastUsedFrame = builder->FrameCount;
-    LastBaked = baked;
+    if (baked != NULL)
+    {
+        baked->LastUsedFrame = builder->FrameCount;
+        ImAtomicStoreRelease(&LastBaked, baked);
+    }
+    ImFontAtlasSharedUnlock(atlas);
     return baked;
 }
 
@@ -5379,6 +6678,8 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
     const char* word_end = text;
     const char* prev_word_end = NULL;
     bool inside_word = true;
+    const ImFontBakedIndexPage* page = NULL; // Index page of last character
+    unsigned int page_n = (unsigned int)-1;
 
     const char* s = text;
     IM_ASSERT(text_end != NULL);
@@ -5408,9 +6709,17 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        if ((c >> IM_FONTBAKED_INDEX_PAGE_BITS) != page_n)
+        {
+            page_n = c >> IM_FONTBAKED_INDEX_PAGE_BITS;
+            page = baked->GetIndexPage(c);
+        }
+        float char_width = page ? ImAtomicLoadRelaxed(&page->AdvanceX[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)]) : -1.0f;
         if (char_width < 0.0f)
+        {
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            page_n = (unsigned int)-1; // Loading may have allocated the page
+        }
 
         if (ImCharIsBlankW(c))
         {
@@ -5474,6 +6783,8 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    const ImFontBakedIndexPage* page = NULL; // Index page of last character
+    unsigned int page_n = (unsigned int)-1;
 
     const char* s = text_begin;
     while (s < text_end)
@@ -5518,9 +6829,17 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        if ((c >> IM_FONTBAKED_INDEX_PAGE_BITS) != page_n)
+        {
+            page_n = c >> IM_FONTBAKED_INDEX_PAGE_BITS;
+            page = baked->GetIndexPage(c);
+        }
+        float char_width = page ? ImAtomicLoadRelaxed(&page->AdvanceX[c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1)]) : -1.0f;
         if (char_width < 0.0f)
+        {
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            page_n = (unsigned int)-1; // Loading may have allocated the page
+        }
         char_width *= scale;
 
         if (line_width + char_width >= max_width)
@@ -5750,10 +7069,10 @@ begin:
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                 {
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv = ImVec2(u1, v2);
                     idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
                     idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
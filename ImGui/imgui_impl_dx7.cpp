@@ -11,14 +11,18 @@
 //  [X] User texture binding (ImTextureID = LPDIRECTDRAWSURFACE7).
 //  [X] Large meshes (ImDrawCmd::VtxOffset) via ImGuiBackendFlags_RendererHasVtxOffset.
 //  [X] IMGUI_USE_BGRA_PACKED_COLOR support.
+//  [X] IMGUI_USE_COMPACT_DRAWVERT support.
 //  [X] Per-command clipping in software (emulates scissor).
+//  [X] Clipped geometry of consecutive commands using the same texture is submitted in one draw call.
+//  [X] Tiled image viewer for images larger than the texture size limit (ImGui_ImplDX7_TiledImageView()).
+//  [X] Presenting the last frame again without clipping it again (ImGui_ImplDX7_RenderLastDrawData()).
 //
 // Limitations / Notes
 // -------------------
 //  - D3D7 has no scissor. We do software clipping instead of trying to
 //    juggle viewports (which caused “ghost UIs” and artifacts).
-//  - Textures must be created with TEXTURE caps. We prefer A8B8G8R8;
-//    fall back to A8R8G8B8 (with CPU R/B swap on upload).
+//  - Textures must be created with TEXTURE caps. We use A8R8G8B8 and fall
+//    back to A4R4G4B4; pixels are converted on upload (SSE2 when available).
 //  - Indices must be 16-bit (D3D7 limitation).
 //  - This backend is community-level; not officially maintained.
 //    Expect fewer tests than modern backends (DX9+, GL, Vulkan).
@@ -33,20 +37,32 @@
 //   ImGui::Render();
 //   ImGui_ImplDX7_RenderDrawData(ImGui::GetDrawData());
 //   ...
+//   ImGui_ImplDX7_RenderLastDrawData();     // present the last frame again, without NewFrame()/Render()
+//   ...
 //   ImGui_ImplDX7_InvalidateDeviceObjects(); // before device loss/shutdown
 //   ImGui_ImplDX7_Shutdown();
 //
 // Implementation outline
 // ----------------------
-//   - Build CPU-side vertex/index arrays (XYZRHW + color + uv).
-//   - Transform ImGui positions into framebuffer space
-//     using (pos - DisplayPos) * FramebufferScale.
+//   - Read ImDrawVert directly from the draw lists, converting to
+//     XYZRHW + color + uv (framebuffer space, (pos - DisplayPos) * FramebufferScale)
+//     as triangles are clipped.
 //   - For each ImDrawCmd, clip its triangles to the cmd's ClipRect
-//     using Sutherland–Hodgman, then draw the clipped mesh.
+//     using Sutherland–Hodgman, appending to a frame-wide vertex/index
+//     arena owned by the backend (reused across frames, no per-command allocation).
+//   - As clipping is already applied, the arena is only submitted when the
+//     texture changes (or before a user callback), across commands and draw lists.
+//   - The arena and its draw calls are kept until the next frame, so the same
+//     frame can be submitted again by only replaying the draw calls.
+//   - The arena is internal to the backend: ImDrawList buffers are not carved
+//     out of it. Vertices are converted while clipping, so contiguous ImDrawData
+//     buffers would not save a copy here, and the spare capacity of the draw
+//     lists (~30% with the demo) is the growth slack a single arena also has.
 //   - Backup/restore a minimal set of D3D7 render states.
 //
 // ---------------------------------------------------------------------------
 
+#define IMGUI_DEFINE_MATH_OPERATORS     // Tiled image view
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx7.h"
@@ -56,12 +72,31 @@
 #include "imgui_internal.h"
 #include <vector>
 #include <cmath> // fabsf in intersection helper
+#include <algorithm>            // std::sort in tiled image eviction
+#include <thread>               // Tiled image workers
+#include <mutex>
+#include <condition_variable>
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wold-style-cast"
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #endif
 
+// A light vertex struct we use while clipping (matches our FVF layout).
+struct ClippedVert {
+    float    x, y, z, rhw;
+    D3DCOLOR col;
+    float    u, v;
+};
+
+// A draw call submitted from the arena (indices are relative to VtxOffset).
+struct ImGui_ImplDX7_Batch
+{
+    IDirectDrawSurface7* Texture;
+    DWORD                VtxOffset, VtxCount;
+    DWORD                IdxOffset, IdxCount;
+};
+
 //------------------------------------------------------------------------------
 // Backend-owned data
 //------------------------------------------------------------------------------
@@ -70,6 +105,18 @@ struct ImGui_ImplDX7_Data
     IDirect3DDevice7* d3d = nullptr; // main D3D7 device
     IDirectDraw7* ddraw = nullptr; // for creating textures
 
+    // Frame-wide arena receiving clipped geometry. Keeps its capacity between frames.
+    std::vector<ClippedVert> FrameVtx;
+    std::vector<WORD>        FrameIdx;
+
+    // Draw calls of the last frame. Their geometry is left in the arena so they can be replayed by ImGui_ImplDX7_RenderLastDrawData().
+    std::vector<ImGui_ImplDX7_Batch> FrameBatches;
+    ImDrawData*              LastDrawData = nullptr;
+    bool                     LastDrawDataCached = false;    // false when the frame has user callbacks, which need to run again
+
+    // Tiled images, to release their textures in ImGui_ImplDX7_InvalidateDeviceObjects().
+    std::vector<ImGui_ImplDX7_TiledImage*> TiledImages;
+
     ImGui_ImplDX7_Data() = default;
 };
 
@@ -110,13 +157,6 @@ struct IMGUI_DX7_CUSTOMVERTEX
 // Simple lerp for floats.
 static inline float Lerp(float a, float b, float t) { return a + (b - a) * t; }
 
-// A light vertex struct we use while clipping (matches our FVF layout).
-struct ClippedVert {
-    float    x, y, z, rhw;
-    D3DCOLOR col;
-    float    u, v;
-};
-
 // Return whether a vertex is inside the half-plane of one side of the rect.
 // side: 0=left, 1=top, 2=right, 3=bottom
 static inline bool InsideBySide(const ClippedVert& p, const ImVec4& R, int side)
@@ -176,10 +216,10 @@ static inline ClippedVert IntersectWithSide(const ClippedVert& P,
 }
 
 // Clip a single triangle ABC against the rect R.
-// Output vertices are appended to out_v, and out_i receives fan triangulation.
+// Output vertices are appended to out_v, and out_i receives fan triangulation (indices relative to out_v[vtx_start]).
 // If the triangle is completely outside, nothing is appended.
 static void EmitClippedTri(const ClippedVert& a, const ClippedVert& b, const ClippedVert& c,
-    const ImVec4& R, std::vector<ClippedVert>& out_v, std::vector<WORD>& out_i)
+    const ImVec4& R, std::vector<ClippedVert>& out_v, std::vector<WORD>& out_i, size_t vtx_start)
 {
     // Start with the original triangle as a polygon.
     ClippedVert poly[8] = { a, b, c }; int n = 3;
@@ -216,7 +256,7 @@ static void EmitClippedTri(const ClippedVert& a, const ClippedVert& b, const Cli
     if (n < 3) return; // fully clipped
 
     // Triangulate clipped polygon as a fan: (0, i, i+1)
-    WORD base = (WORD)out_v.size();
+    WORD base = (WORD)(out_v.size() - vtx_start);
     for (int i = 0; i < n; ++i) out_v.push_back(poly[i]);
     for (int i = 1; i < n - 1; ++i) {
         out_i.push_back(base);
@@ -349,32 +389,117 @@ static void ImGui_ImplDX7_SetupRenderState(ImDrawData* /*draw_data*/)
     d3d->SetTransform(D3DTRANSFORMSTATE_PROJECTION, &I);
 }
 
-// Convert RGBA32 -> BGRA32 if needed when uploading the font atlas.
-static inline ImU32 ImGui_ImplDX7_RgbaToBgra(ImU32 rgba)
+//------------------------------------------------------------------------------
+// Pixel conversion for texture uploads
+// ImGui RGBA32 pixels are converted to whatever 16/32-bit RGB format the surface
+// was created with (A8R8G8B8, A4R4G4B4, A1R5G5B5...), described by its bit masks.
+//------------------------------------------------------------------------------
+
+// Destination channel = (8-bit source channel >> Loss) << Shift
+struct ImGui_ImplDX7_PixelChannel
 {
-#ifndef IMGUI_USE_BGRA_PACKED_COLOR
-    return ((rgba & 0xFF00FF00) | ((rgba & 0x00FF0000) >> 16) | ((rgba & 0x000000FF) << 16));
-#else
-    return rgba;
+    int SrcShift, Loss, Shift;
+};
+
+struct ImGui_ImplDX7_PixelLayout
+{
+    int                         BytesPerPixel;
+    ImGui_ImplDX7_PixelChannel  Channels[4];    // R, G, B, A
+};
+
+static ImGui_ImplDX7_PixelChannel ImGui_ImplDX7_GetPixelChannel(int src_shift, DWORD mask)
+{
+    ImGui_ImplDX7_PixelChannel ch = { src_shift, 8, 0 }; // Missing channel: all bits are dropped
+    if (mask == 0)
+        return ch;
+    int bits = 0;
+    while ((mask & 1) == 0) { mask >>= 1; ch.Shift++; }
+    while ((mask & 1) != 0) { mask >>= 1; bits++; }
+    ch.Loss = (bits < 8) ? 8 - bits : 0;
+    return ch;
+}
+
+static bool ImGui_ImplDX7_GetPixelLayout(const DDPIXELFORMAT& pf, ImGui_ImplDX7_PixelLayout* out_layout)
+{
+    if ((pf.dwFlags & DDPF_RGB) == 0 || (pf.dwRGBBitCount != 16 && pf.dwRGBBitCount != 32))
+        return false;
+    out_layout->BytesPerPixel = (int)pf.dwRGBBitCount / 8;
+    out_layout->Channels[0] = ImGui_ImplDX7_GetPixelChannel(IM_COL32_R_SHIFT, pf.dwRBitMask);
+    out_layout->Channels[1] = ImGui_ImplDX7_GetPixelChannel(IM_COL32_G_SHIFT, pf.dwGBitMask);
+    out_layout->Channels[2] = ImGui_ImplDX7_GetPixelChannel(IM_COL32_B_SHIFT, pf.dwBBitMask);
+    out_layout->Channels[3] = ImGui_ImplDX7_GetPixelChannel(IM_COL32_A_SHIFT, (pf.dwFlags & DDPF_ALPHAPIXELS) ? pf.dwRGBAlphaBitMask : 0);
+    return true;
+}
+
+static inline ImU32 ImGui_ImplDX7_ConvertPixel(ImU32 rgba, const ImGui_ImplDX7_PixelLayout& layout)
+{
+    ImU32 out = 0;
+    for (const ImGui_ImplDX7_PixelChannel& ch : layout.Channels)
+        out |= (((rgba >> ch.SrcShift) & 0xFF) >> ch.Loss) << ch.Shift;
+    return out;
+}
+
+// Convert a w*h block of RGBA32 pixels, writing rows 'dst_pitch' bytes apart (DDSURFACEDESC2::lPitch).
+static void ImGui_ImplDX7_ConvertPixels(const ImU32* src, int src_pitch, unsigned char* dst, int dst_pitch, int w, int h, const ImGui_ImplDX7_PixelLayout& layout)
+{
+#ifdef IMGUI_ENABLE_SSE2
+    const __m128i mask_ff = _mm_set1_epi32(0xFF);
+    __m128i src_shift[4], loss[4], shift[4];
+    for (int n = 0; n < 4; n++)
+    {
+        src_shift[n] = _mm_cvtsi32_si128(layout.Channels[n].SrcShift);
+        loss[n] = _mm_cvtsi32_si128(layout.Channels[n].Loss);
+        shift[n] = _mm_cvtsi32_si128(layout.Channels[n].Shift);
+    }
 #endif
+    for (int y = 0; y < h; y++, src = (const ImU32*)(const void*)((const unsigned char*)src + src_pitch), dst += dst_pitch)
+    {
+        int x = 0;
+#ifdef IMGUI_ENABLE_SSE2
+        // 8 pixels per iteration, same math as ImGui_ImplDX7_ConvertPixel() on 32-bit lanes.
+        for (; x + 8 <= w; x += 8)
+        {
+            __m128i out[2];
+            for (int half = 0; half < 2; half++)
+            {
+                const __m128i rgba = _mm_loadu_si128((const __m128i*)(const void*)(src + x + half * 4));
+                __m128i v = _mm_setzero_si128();
+                for (int n = 0; n < 4; n++)
+                    v = _mm_or_si128(v, _mm_sll_epi32(_mm_srl_epi32(_mm_and_si128(_mm_srl_epi32(rgba, src_shift[n]), mask_ff), loss[n]), shift[n]));
+                out[half] = v;
+            }
+            if (layout.BytesPerPixel == 4)
+            {
+                _mm_storeu_si128((__m128i*)(void*)(dst + x * 4), out[0]);
+                _mm_storeu_si128((__m128i*)(void*)(dst + x * 4 + 16), out[1]);
+            }
+            else
+            {
+                // Sign-extend low 16 bits so the signed saturating pack keeps them unchanged.
+                const __m128i lo = _mm_srai_epi32(_mm_slli_epi32(out[0], 16), 16);
+                const __m128i hi = _mm_srai_epi32(_mm_slli_epi32(out[1], 16), 16);
+                _mm_storeu_si128((__m128i*)(void*)(dst + x * 2), _mm_packs_epi32(lo, hi));
+            }
+        }
+#endif
+        if (layout.BytesPerPixel == 4)
+            for (; x < w; x++)
+                ((ImU32*)(void*)dst)[x] = ImGui_ImplDX7_ConvertPixel(src[x], layout);
+        else
+            for (; x < w; x++)
+                ((ImU16*)(void*)dst)[x] = (ImU16)ImGui_ImplDX7_ConvertPixel(src[x], layout);
+    }
 }
 
 //------------------------------------------------------------------------------
-// Font texture (ImGui atlas) upload to DirectDraw7 texture surface
+// Texture creation and upload (font atlas, tiled images)
 //------------------------------------------------------------------------------
-static IDirectDrawSurface7* g_FontTexture = nullptr;
 
-static bool ImGui_ImplDX7_CreateFontsTexture()
+// Create a w*h texture surface. Prefer 32-bit ARGB in video memory, fall back to system memory and to 16-bit A4R4G4B4.
+static IDirectDrawSurface7* ImGui_ImplDX7_CreateTexture(int w, int h)
 {
     ImGui_ImplDX7_Data* bd = ImGui_ImplDX7_GetBackendData();
-    if (!bd || !bd->ddraw) return false;
-
-    ImGuiIO& io = ImGui::GetIO();
-
-    // Ask ImGui for RGBA32 pixels.
-    unsigned char* pixels = nullptr;
-    int w = 0, h = 0;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &w, &h);
+    if (!bd || !bd->ddraw) return nullptr;
 
     // Describe a 32-bit ARGB texture.
     DDSURFACEDESC2 desc{};
@@ -396,32 +521,78 @@ static bool ImGui_ImplDX7_CreateFontsTexture()
     pf.dwBBitMask = 0x000000FF; // B
     desc.ddpfPixelFormat = pf;
 
-    if (FAILED(bd->ddraw->CreateSurface(&desc, &g_FontTexture, nullptr)))
+    IDirectDrawSurface7* tex = nullptr;
+    if (FAILED(bd->ddraw->CreateSurface(&desc, &tex, nullptr)))
     {
         // System memory fallback if VRAM creation failed.
         desc.ddsCaps.dwCaps = DDSCAPS_TEXTURE | DDSCAPS_SYSTEMMEMORY;
-        if (FAILED(bd->ddraw->CreateSurface(&desc, &g_FontTexture, nullptr)))
-            return false;
+        if (FAILED(bd->ddraw->CreateSurface(&desc, &tex, nullptr)))
+        {
+            // 16-bit A4R4G4B4 fallback for old devices without 32-bit textures.
+            desc.ddpfPixelFormat.dwRGBBitCount = 16;
+            desc.ddpfPixelFormat.dwRGBAlphaBitMask = 0xF000;
+            desc.ddpfPixelFormat.dwRBitMask = 0x0F00;
+            desc.ddpfPixelFormat.dwGBitMask = 0x00F0;
+            desc.ddpfPixelFormat.dwBBitMask = 0x000F;
+            desc.ddsCaps.dwCaps = DDSCAPS_TEXTURE | DDSCAPS_VIDEOMEMORY;
+            if (FAILED(bd->ddraw->CreateSurface(&desc, &tex, nullptr)))
+            {
+                desc.ddsCaps.dwCaps = DDSCAPS_TEXTURE | DDSCAPS_SYSTEMMEMORY;
+                if (FAILED(bd->ddraw->CreateSurface(&desc, &tex, nullptr)))
+                    return nullptr;
+            }
+        }
     }
+    return tex;
+}
 
-    // Lock and copy pixels (RGBA -> ARGB with optional R/B swap).
+// Upload a w*h block of RGBA32 pixels to the top-left corner of a texture, converting to the surface format.
+static bool ImGui_ImplDX7_UpdateTexture(IDirectDrawSurface7* tex, const ImU32* pixels, int src_pitch, int w, int h)
+{
+    // Lock and convert pixels to the surface format (which the driver reports back in the locked desc).
     RECT r{ 0,0,w,h };
     DDSURFACEDESC2 lockd{}; lockd.dwSize = sizeof(lockd);
-    if (FAILED(g_FontTexture->Lock(&r, &lockd, 0, 0)))
-    {
-        g_FontTexture->Release(); g_FontTexture = nullptr;
+    ImGui_ImplDX7_PixelLayout layout;
+    if (FAILED(tex->Lock(&r, &lockd, DDLOCK_WAIT | DDLOCK_WRITEONLY, 0)))
         return false;
+    if (!ImGui_ImplDX7_GetPixelLayout(lockd.ddpfPixelFormat, &layout))
+    {
+        DDSURFACEDESC2 desc{}; desc.dwSize = sizeof(desc);
+        tex->GetSurfaceDesc(&desc);
+        if (!ImGui_ImplDX7_GetPixelLayout(desc.ddpfPixelFormat, &layout))
+        {
+            tex->Unlock(nullptr);
+            return false;
+        }
     }
 
-    const ImU32* src = (const ImU32*)pixels;
-    for (int y = 0; y < h; y++)
+    ImGui_ImplDX7_ConvertPixels(pixels, src_pitch, (unsigned char*)lockd.lpSurface, (int)lockd.lPitch, w, h, layout);
+    tex->Unlock(nullptr);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Font texture (ImGui atlas) upload to DirectDraw7 texture surface
+//------------------------------------------------------------------------------
+static IDirectDrawSurface7* g_FontTexture = nullptr;
+
+static bool ImGui_ImplDX7_CreateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Ask ImGui for RGBA32 pixels.
+    unsigned char* pixels = nullptr;
+    int w = 0, h = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &w, &h);
+
+    g_FontTexture = ImGui_ImplDX7_CreateTexture(w, h);
+    if (!g_FontTexture)
+        return false;
+    if (!ImGui_ImplDX7_UpdateTexture(g_FontTexture, (const ImU32*)(const void*)pixels, w * 4, w, h))
     {
-        ImU32* dst = (ImU32*)((unsigned char*)lockd.lpSurface + y * lockd.lPitch);
-        const ImU32* s = src + y * w;
-        for (int x = 0; x < w; x++)
-            dst[x] = ImGui_ImplDX7_RgbaToBgra(s[x]);
+        g_FontTexture->Release(); g_FontTexture = nullptr;
+        return false;
     }
-    g_FontTexture->Unlock(nullptr);
 
     io.Fonts->SetTexID((ImTextureID)(intptr_t)g_FontTexture);
     return true;
@@ -478,9 +649,20 @@ bool ImGui_ImplDX7_CreateDeviceObjects()
     return ImGui_ImplDX7_CreateFontsTexture();
 }
 
+static void ImGui_ImplDX7_ReleaseTiledImageTextures(ImGui_ImplDX7_TiledImage* image);
+
 void ImGui_ImplDX7_InvalidateDeviceObjects()
 {
     ImGui_ImplDX7_DestroyFontsTexture();
+    if (ImGui_ImplDX7_Data* bd = ImGui_ImplDX7_GetBackendData())
+    {
+        // The last frame refers to released textures: a new frame needs to be rendered first.
+        bd->FrameBatches.clear();
+        bd->LastDrawData = nullptr;
+        bd->LastDrawDataCached = false;
+        for (ImGui_ImplDX7_TiledImage* image : bd->TiledImages)
+            ImGui_ImplDX7_ReleaseTiledImageTextures(image);
+    }
 }
 
 void ImGui_ImplDX7_NewFrame()
@@ -493,16 +675,31 @@ void ImGui_ImplDX7_NewFrame()
 //------------------------------------------------------------------------------
 // Main render entry point: converts ImGui draw data to D3D7 calls.
 //------------------------------------------------------------------------------
-void ImGui_ImplDX7_RenderDrawData(ImDrawData* draw_data)
+static void ImGui_ImplDX7_DrawBatch(IDirect3DDevice7* d3d, ImGui_ImplDX7_Data* bd, const ImGui_ImplDX7_Batch& batch)
 {
-    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
-        return;
+    d3d->SetTexture(0, batch.Texture);
+    d3d->DrawIndexedPrimitive(
+        D3DPT_TRIANGLELIST,
+        IMGUI_DX7_FVF,
+        bd->FrameVtx.data() + batch.VtxOffset, batch.VtxCount,
+        bd->FrameIdx.data() + batch.IdxOffset, batch.IdxCount,
+        0);
+}
 
+void ImGui_ImplDX7_RenderDrawData(ImDrawData* draw_data)
+{
     // D3D7 DrawIndexedPrimitive expects 16-bit indices (WORD).
     IM_ASSERT(sizeof(ImDrawIdx) == 2 && "D3D7 backend requires 16-bit ImDrawIdx!");
 
     ImGui_ImplDX7_Data* bd = ImGui_ImplDX7_GetBackendData();
     IDirect3DDevice7* d3d = bd->d3d;
+    std::vector<ImGui_ImplDX7_Batch>& batches = bd->FrameBatches;
+    batches.clear();
+    bd->LastDrawData = draw_data;
+    bd->LastDrawDataCached = true;
+
+    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
+        return;
 
     // Backup application state (we touch a subset).
     ImGui_ImplDX7_StateBackup backup{};
@@ -511,53 +708,45 @@ void ImGui_ImplDX7_RenderDrawData(ImDrawData* draw_data)
     // Set render state appropriate for UI.
     ImGui_ImplDX7_SetupRenderState(draw_data);
 
-    // Build CPU-side contiguous vertex & index buffers for the whole frame.
-    const int total_vtx = draw_data->TotalVtxCount;
-    const int total_idx = draw_data->TotalIdxCount;
-
-    ImVector<IMGUI_DX7_CUSTOMVERTEX> vbuf;
-    ImVector<ImDrawIdx>              ibuf;
-    vbuf.resize(total_vtx);
-    ibuf.resize(total_idx);
-
     // Transform from ImGui-space to framebuffer-space.
+    // Vertices are read straight from the draw lists and converted while clipping (no intermediate copy
+    // of the whole frame in IMGUI_DX7_CUSTOMVERTEX format), which saves a full write+read of the frame vertices.
     const ImVec2 clip_off = draw_data->DisplayPos;
     const ImVec2 clip_scale = draw_data->FramebufferScale; // often (1,1)
 
-    IMGUI_DX7_CUSTOMVERTEX* vtx_dst = vbuf.Data;
-    ImDrawIdx* idx_dst = ibuf.Data;
-
-    for (int n = 0; n < draw_data->CmdListsCount; n++)
-    {
-        const ImDrawList* dl = draw_data->CmdLists[n];
-        const ImDrawVert* vtx_src = dl->VtxBuffer.Data;
-
-        // Convert vertices: XYZRHW + ARGB + UV
-        for (int i = 0; i < dl->VtxBuffer.Size; i++)
-        {
-            vtx_dst->x = (vtx_src->pos.x - clip_off.x) * clip_scale.x;
-            vtx_dst->y = (vtx_src->pos.y - clip_off.y) * clip_scale.y;
-            vtx_dst->z = 0.0f;
-            vtx_dst->rhw = 1.0f;
-            vtx_dst->col = IMGUI_COL_TO_DX_ARGB(vtx_src->col);
-            vtx_dst->u = vtx_src->uv.x;
-            vtx_dst->v = vtx_src->uv.y;
-            ++vtx_dst; ++vtx_src;
-        }
-
-        // Copy indices as-is (16-bit).
-        memcpy(idx_dst, dl->IdxBuffer.Data, (size_t)dl->IdxBuffer.Size * sizeof(ImDrawIdx));
-        idx_dst += dl->IdxBuffer.Size;
-    }
-
-    // Running offsets into our contiguous buffers for each draw list.
-    int global_vtx_offset = 0;
-    int global_idx_offset = 0;
-
     // Framebuffer size used to clamp clip rects (defensive).
     const int fb_width = (int)(draw_data->DisplaySize.x * clip_scale.x);
     const int fb_height = (int)(draw_data->DisplaySize.y * clip_scale.y);
 
+    // Clipped geometry is appended to the arena and submitted when the texture changes.
+    // A clipped triangle has at most 7 vertices: submit early so 16-bit indices never overflow.
+    // The arena is not cleared after each submission, so the draw calls can be replayed by ImGui_ImplDX7_RenderLastDrawData().
+    std::vector<ClippedVert>& cv = bd->FrameVtx;
+    std::vector<WORD>&        ci = bd->FrameIdx;
+    cv.clear();
+    ci.clear();
+    IDirectDrawSurface7* batch_tex = nullptr;
+    size_t batch_vtx = 0, batch_idx = 0;
+    auto flush = [&]() {
+        if (ci.size() > batch_idx)
+        {
+            ImGui_ImplDX7_Batch batch = { batch_tex, (DWORD)batch_vtx, (DWORD)(cv.size() - batch_vtx), (DWORD)batch_idx, (DWORD)(ci.size() - batch_idx) };
+            ImGui_ImplDX7_DrawBatch(d3d, bd, batch);
+            batches.push_back(batch);
+        }
+        batch_vtx = cv.size();
+        batch_idx = ci.size();
+        };
+
+    // Convert ImDrawVert to ClippedVert (matches our FVF layout): XYZRHW + ARGB + UV.
+    // 'ImVec2 uv = s.uv' also handles the 16-bit UV of IMGUI_USE_COMPACT_DRAWVERT.
+    auto toCV = [&](const ImDrawVert& s) {
+        const ImVec2 uv = s.uv;
+        ClippedVert d;
+        d.x = (s.pos.x - clip_off.x) * clip_scale.x; d.y = (s.pos.y - clip_off.y) * clip_scale.y; d.z = 0.0f; d.rhw = 1.0f;
+        d.col = IMGUI_COL_TO_DX_ARGB(s.col); d.u = uv.x; d.v = uv.y; return d;
+        };
+
     // Iterate draw commands and render them.
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
@@ -570,12 +759,14 @@ void ImGui_ImplDX7_RenderDrawData(ImDrawData* draw_data)
             // Handle user callbacks (rare).
             if (pcmd->UserCallback)
             {
+                flush();
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
                 {
                     ImGui_ImplDX7_SetupRenderState(draw_data);
                 }
                 else
                 {
+                    bd->LastDrawDataCached = false;
                     pcmd->UserCallback(dl, pcmd);
                     // Reset common state after callback so the next draw is stable.
                     ImGui_ImplDX7_SetupRenderState(draw_data);
@@ -602,55 +793,449 @@ void ImGui_ImplDX7_RenderDrawData(ImDrawData* draw_data)
             if (cr_max.x > (float)fb_width)  cr_max.x = (float)fb_width;
             if (cr_max.y > (float)fb_height) cr_max.y = (float)fb_height;
 
-            // Bind the texture for this draw.
-            d3d->SetTexture(0, (IDirectDrawSurface7*)pcmd->GetTexID());
+            // Texture for this draw: submit what was accumulated with the previous one.
+            IDirectDrawSurface7* tex = (IDirectDrawSurface7*)pcmd->GetTexID();
+            if (tex != batch_tex)
+            {
+                flush();
+                batch_tex = tex;
+            }
 
-            // Compute start pointers into the big buffers for this cmd.
-            const IMGUI_DX7_CUSTOMVERTEX* vstart = vbuf.Data + (pcmd->VtxOffset + global_vtx_offset);
-            const ImDrawIdx* istart = ibuf.Data + (pcmd->IdxOffset + global_idx_offset);
+            // Compute start pointers into the draw list buffers for this cmd.
+            const ImDrawVert* vstart = dl->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* istart = dl->IdxBuffer.Data + pcmd->IdxOffset;
 
             // Rect as {minX, minY, maxX, maxY}.
             ImVec4 R = ImVec4(cr_min.x, cr_min.y, cr_max.x, cr_max.y);
 
-            // Temporary clipped buffers (per-draw-call).
-            std::vector<ClippedVert> cv;
-            std::vector<WORD>        ci;
-            cv.reserve(pcmd->ElemCount);
-            ci.reserve(pcmd->ElemCount);
-
-            // Convert our FVF vertex to ClippedVert.
-            auto toCV = [](const IMGUI_DX7_CUSTOMVERTEX& s) {
-                ClippedVert d; d.x = s.x; d.y = s.y; d.z = s.z; d.rhw = s.rhw; d.col = s.col; d.u = s.u; d.v = s.v; return d;
-                };
-
             // Process triangles in this command, clip each, and push to cv/ci.
             for (unsigned t = 0; t < pcmd->ElemCount; t += 3)
             {
-                const IMGUI_DX7_CUSTOMVERTEX& A = vstart[istart[t + 0]];
-                const IMGUI_DX7_CUSTOMVERTEX& B = vstart[istart[t + 1]];
-                const IMGUI_DX7_CUSTOMVERTEX& C = vstart[istart[t + 2]];
-                EmitClippedTri(toCV(A), toCV(B), toCV(C), R, cv, ci);
+                if (cv.size() - batch_vtx > 0xFFFF - 7)
+                    flush();
+                const ImDrawVert& A = vstart[istart[t + 0]];
+                const ImDrawVert& B = vstart[istart[t + 1]];
+                const ImDrawVert& C = vstart[istart[t + 2]];
+                EmitClippedTri(toCV(A), toCV(B), toCV(C), R, cv, ci, batch_vtx);
             }
+        }
+    }
+    flush();
+
+    // Restore application state.
+    backup.Restore(d3d);
+}
+
+// Submit the last frame again, e.g. to present at the display refresh rate while the UI is updated at a lower rate.
+// Draw lists are left untouched until the next ImGui::NewFrame(), so the last draw data is still valid here.
+// - The draw calls recorded by the last ImGui_ImplDX7_RenderDrawData() are replayed, skipping clipping and conversion.
+// - Frames with user callbacks (other than ImDrawCallback_ResetRenderState) are rendered again from the draw data instead.
+void ImGui_ImplDX7_RenderLastDrawData()
+{
+    ImGui_ImplDX7_Data* bd = ImGui_ImplDX7_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplDX7_Init()?");
+    if (bd->LastDrawData == nullptr)
+        return;
+    if (!bd->LastDrawDataCached)
+    {
+        ImGui_ImplDX7_RenderDrawData(bd->LastDrawData);
+        return;
+    }
+
+    IDirect3DDevice7* d3d = bd->d3d;
+    ImGui_ImplDX7_StateBackup backup{};
+    backup.Capture(d3d);
+    ImGui_ImplDX7_SetupRenderState(bd->LastDrawData);
+    for (const ImGui_ImplDX7_Batch& batch : bd->FrameBatches)
+        ImGui_ImplDX7_DrawBatch(d3d, bd, batch);
+    backup.Restore(d3d);
+}
+
+//------------------------------------------------------------------------------
+// Tiled image viewer
+// - Tiles of all levels are stored in a single array allocated upfront (~5.5k tiles for a 16k x 16k image).
+// - Tile State and Pixels are shared with worker threads: State is only modified with Mutex locked,
+//   and Pixels are only touched by the render thread once the tile is in the Loaded state.
+// - Texture and LastUsedFrame are only used by the render thread.
+//------------------------------------------------------------------------------
+#define IMGUI_DX7_TILE_SIZE                 256     // Below the texture size limit of any D3D7 device. Square and power of two for older devices.
+#define IMGUI_DX7_TILE_UPLOADS_PER_FRAME    8       // Tiles are uploaded progressively to keep a stable frame rate
+#define IMGUI_DX7_TILE_STALE_FRAMES         60      // Loaded tiles not displayed for this many frames are discarded instead of uploaded
+
+enum ImGui_ImplDX7_TileState
+{
+    ImGui_ImplDX7_TileState_Empty,
+    ImGui_ImplDX7_TileState_Queued,         // Waiting for a worker
+    ImGui_ImplDX7_TileState_Loading,        // Being loaded by a worker
+    ImGui_ImplDX7_TileState_Loaded,         // Pixels waiting for upload
+    ImGui_ImplDX7_TileState_Resident,       // Texture created
+    ImGui_ImplDX7_TileState_Failed,         // load_tile() returned false: not requested again
+};
+
+struct ImGui_ImplDX7_Tile
+{
+    ImGui_ImplDX7_TileState State = ImGui_ImplDX7_TileState_Empty;
+    std::vector<ImU32>      Pixels;                 // IMGUI_DX7_TILE_SIZE * IMGUI_DX7_TILE_SIZE pixels, with last row/column repeated for filtering
+    IDirectDrawSurface7*    Texture = nullptr;
+    size_t                  TextureBytes = 0;
+    int                     LastUsedFrame = -1;
+};
+
+struct ImGui_ImplDX7_TiledImage
+{
+    int                         Width = 0, Height = 0;
+    int                         LevelsCount = 0;
+    int                         LevelFirstTile[32] = {};
+    int                         LevelTilesX[32] = {};
+    int                         LevelTilesY[32] = {};
+    ImGui_ImplDX7_LoadTileFunc  LoadTile = nullptr;
+    void*                       UserData = nullptr;
+    size_t                      VramBudget = 0;
+    size_t                      VramUsed = 0;
+    std::vector<ImGui_ImplDX7_Tile> Tiles;
+    std::vector<int>            Resident;           // Tiles with a texture
+    std::vector<int>            Wanted;             // Tiles needed this frame, least important first
+
+    // Shared with workers
+    std::mutex                  Mutex;
+    std::condition_variable     Cond;
+    std::vector<int>            Queue;              // Requested tiles, most important last
+    std::vector<int>            Loaded;             // Tiles in Loaded state
+    std::vector<std::thread>    Workers;
+    bool                        Quit = false;
+
+    // View
+    ImVec2                      ViewCenter;         // In level 0 pixels
+    float                       Zoom = 0.0f;        // Screen pixels per level 0 pixel. 0.0f: fit on next display.
+};
 
-            // Submit clipped triangles (if any).
-            if (!ci.empty())
+static int ImGui_ImplDX7_GetTileIndex(const ImGui_ImplDX7_TiledImage* image, int level, int tx, int ty)
+{
+    return image->LevelFirstTile[level] + ty * image->LevelTilesX[level] + tx;
+}
+
+// Return rectangle of a tile in pixels of its level.
+static void ImGui_ImplDX7_GetTileRect(const ImGui_ImplDX7_TiledImage* image, int tile_n, int* out_level, int* out_x, int* out_y, int* out_w, int* out_h)
+{
+    int level = image->LevelsCount - 1;
+    while (tile_n < image->LevelFirstTile[level])
+        level--;
+    const int tile_in_level = tile_n - image->LevelFirstTile[level];
+    const int level_w = (image->Width + (1 << level) - 1) >> level;
+    const int level_h = (image->Height + (1 << level) - 1) >> level;
+    *out_level = level;
+    *out_x = (tile_in_level % image->LevelTilesX[level]) * IMGUI_DX7_TILE_SIZE;
+    *out_y = (tile_in_level / image->LevelTilesX[level]) * IMGUI_DX7_TILE_SIZE;
+    *out_w = ImMin(IMGUI_DX7_TILE_SIZE, level_w - *out_x);
+    *out_h = ImMin(IMGUI_DX7_TILE_SIZE, level_h - *out_y);
+}
+
+static void ImGui_ImplDX7_TiledImageWorker(ImGui_ImplDX7_TiledImage* image)
+{
+    std::vector<ImU32> pixels;
+    std::unique_lock<std::mutex> lock(image->Mutex);
+    for (;;)
+    {
+        image->Cond.wait(lock, [image] { return image->Quit || !image->Queue.empty(); });
+        if (image->Quit)
+            return;
+        const int tile_n = image->Queue.back();
+        image->Queue.pop_back();
+        image->Tiles[tile_n].State = ImGui_ImplDX7_TileState_Loading;
+        lock.unlock();
+
+        int level, x, y, w, h;
+        ImGui_ImplDX7_GetTileRect(image, tile_n, &level, &x, &y, &w, &h);
+        pixels.resize(IMGUI_DX7_TILE_SIZE * IMGUI_DX7_TILE_SIZE);
+        const bool ok = image->LoadTile(image->UserData, level, x, y, w, h, pixels.data(), IMGUI_DX7_TILE_SIZE);
+        if (ok)
+        {
+            // Repeat last column/row of partial tiles, so linear filtering at the edge doesn't sample uninitialized texels.
+            if (w < IMGUI_DX7_TILE_SIZE)
+                for (int row = 0; row < h; row++)
+                    pixels[row * IMGUI_DX7_TILE_SIZE + w] = pixels[row * IMGUI_DX7_TILE_SIZE + w - 1];
+            if (h < IMGUI_DX7_TILE_SIZE)
+                memcpy(&pixels[h * IMGUI_DX7_TILE_SIZE], &pixels[(h - 1) * IMGUI_DX7_TILE_SIZE], IMGUI_DX7_TILE_SIZE * sizeof(ImU32));
+        }
+
+        lock.lock();
+        ImGui_ImplDX7_Tile& tile = image->Tiles[tile_n];
+        tile.State = ok ? ImGui_ImplDX7_TileState_Loaded : ImGui_ImplDX7_TileState_Failed;
+        if (ok)
+        {
+            tile.Pixels.swap(pixels);
+            image->Loaded.push_back(tile_n);
+        }
+    }
+}
+
+ImGui_ImplDX7_TiledImage* ImGui_ImplDX7_CreateTiledImage(int width, int height, ImGui_ImplDX7_LoadTileFunc load_tile, void* user_data, size_t vram_budget, int worker_count)
+{
+    IM_ASSERT(width > 0 && height > 0 && load_tile != nullptr && worker_count > 0);
+    ImGui_ImplDX7_TiledImage* image = IM_NEW(ImGui_ImplDX7_TiledImage)();
+    image->Width = width;
+    image->Height = height;
+    image->LoadTile = load_tile;
+    image->UserData = user_data;
+    image->VramBudget = vram_budget;
+
+    // Build pyramid down to a level fitting in a single tile.
+    int tiles_count = 0;
+    for (int level = 0; ; level++)
+    {
+        IM_ASSERT(level < IM_ARRAYSIZE(image->LevelFirstTile));
+        const int level_w = (width + (1 << level) - 1) >> level;
+        const int level_h = (height + (1 << level) - 1) >> level;
+        image->LevelFirstTile[level] = tiles_count;
+        image->LevelTilesX[level] = (level_w + IMGUI_DX7_TILE_SIZE - 1) / IMGUI_DX7_TILE_SIZE;
+        image->LevelTilesY[level] = (level_h + IMGUI_DX7_TILE_SIZE - 1) / IMGUI_DX7_TILE_SIZE;
+        tiles_count += image->LevelTilesX[level] * image->LevelTilesY[level];
+        image->LevelsCount = level + 1;
+        if (level_w <= IMGUI_DX7_TILE_SIZE && level_h <= IMGUI_DX7_TILE_SIZE)
+            break;
+    }
+    image->Tiles.resize(tiles_count);
+
+    if (ImGui_ImplDX7_Data* bd = ImGui_ImplDX7_GetBackendData())
+        bd->TiledImages.push_back(image);
+    for (int n = 0; n < worker_count; n++)
+        image->Workers.emplace_back(ImGui_ImplDX7_TiledImageWorker, image);
+    return image;
+}
+
+static void ImGui_ImplDX7_ReleaseTiledImageTextures(ImGui_ImplDX7_TiledImage* image)
+{
+    std::lock_guard<std::mutex> lock(image->Mutex);
+    for (int tile_n : image->Resident)
+    {
+        ImGui_ImplDX7_Tile& tile = image->Tiles[tile_n];
+        tile.Texture->Release();
+        tile.Texture = nullptr;
+        tile.State = ImGui_ImplDX7_TileState_Empty;
+    }
+    image->Resident.clear();
+    image->VramUsed = 0;
+}
+
+void ImGui_ImplDX7_DestroyTiledImage(ImGui_ImplDX7_TiledImage* image)
+{
+    if (image == nullptr)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(image->Mutex);
+        image->Quit = true;
+    }
+    image->Cond.notify_all();
+    for (std::thread& worker : image->Workers)
+        worker.join();
+    ImGui_ImplDX7_ReleaseTiledImageTextures(image);
+
+    if (ImGui_ImplDX7_Data* bd = ImGui_ImplDX7_GetBackendData())
+    {
+        auto it = std::find(bd->TiledImages.begin(), bd->TiledImages.end(), image);
+        if (it != bd->TiledImages.end())
+            bd->TiledImages.erase(it);
+    }
+    IM_DELETE(image);
+}
+
+// Submit requests for this frame, upload a few loaded tiles, and release least recently used textures when over budget.
+static void ImGui_ImplDX7_UpdateTiledImage(ImGui_ImplDX7_TiledImage* image, int frame_count)
+{
+    int uploads[IMGUI_DX7_TILE_UPLOADS_PER_FRAME];
+    int uploads_count = 0;
+    bool has_requests;
+    {
+        std::lock_guard<std::mutex> lock(image->Mutex);
+
+        // Replace requests of previous frames, so tiles which are no longer visible are not loaded.
+        for (int tile_n : image->Queue)
+            if (image->Tiles[tile_n].State == ImGui_ImplDX7_TileState_Queued)
+                image->Tiles[tile_n].State = ImGui_ImplDX7_TileState_Empty;
+        image->Queue.clear();
+        for (int tile_n : image->Wanted)
+            if (image->Tiles[tile_n].State == ImGui_ImplDX7_TileState_Empty)
             {
-                d3d->DrawIndexedPrimitive(
-                    D3DPT_TRIANGLELIST,
-                    IMGUI_DX7_FVF,
-                    cv.data(), (DWORD)cv.size(),
-                    ci.data(), (DWORD)ci.size(),
-                    0);
+                image->Tiles[tile_n].State = ImGui_ImplDX7_TileState_Queued;
+                image->Queue.push_back(tile_n);
             }
+        has_requests = !image->Queue.empty();
+
+        // Take loaded tiles (most recent first). Tiles not displayed for a while are discarded.
+        while (!image->Loaded.empty() && uploads_count < IMGUI_DX7_TILE_UPLOADS_PER_FRAME)
+        {
+            const int tile_n = image->Loaded.back();
+            image->Loaded.pop_back();
+            ImGui_ImplDX7_Tile& tile = image->Tiles[tile_n];
+            if (frame_count - tile.LastUsedFrame > IMGUI_DX7_TILE_STALE_FRAMES)
+            {
+                tile.State = ImGui_ImplDX7_TileState_Empty;
+                std::vector<ImU32>().swap(tile.Pixels);
+                continue;
+            }
+            uploads[uploads_count++] = tile_n;
         }
+    }
+    if (has_requests)
+        image->Cond.notify_all();
 
-        // Advance the global offsets to next draw list.
-        global_idx_offset += dl->IdxBuffer.Size;
-        global_vtx_offset += dl->VtxBuffer.Size;
+    // Upload (workers don't touch tiles in Loaded state)
+    for (int upload_n = 0; upload_n < uploads_count; upload_n++)
+    {
+        ImGui_ImplDX7_Tile& tile = image->Tiles[uploads[upload_n]];
+        int level, x, y, w, h;
+        ImGui_ImplDX7_GetTileRect(image, uploads[upload_n], &level, &x, &y, &w, &h);
+        w = ImMin(w + 1, IMGUI_DX7_TILE_SIZE);
+        h = ImMin(h + 1, IMGUI_DX7_TILE_SIZE);
+        tile.Texture = ImGui_ImplDX7_CreateTexture(IMGUI_DX7_TILE_SIZE, IMGUI_DX7_TILE_SIZE);
+        if (tile.Texture && !ImGui_ImplDX7_UpdateTexture(tile.Texture, tile.Pixels.data(), IMGUI_DX7_TILE_SIZE * 4, w, h))
+        {
+            tile.Texture->Release();
+            tile.Texture = nullptr;
+        }
+        std::vector<ImU32>().swap(tile.Pixels);
+        if (tile.Texture)
+        {
+            DDSURFACEDESC2 desc{}; desc.dwSize = sizeof(desc);
+            tile.Texture->GetSurfaceDesc(&desc);
+            tile.TextureBytes = (size_t)IMGUI_DX7_TILE_SIZE * IMGUI_DX7_TILE_SIZE * (desc.ddpfPixelFormat.dwRGBBitCount / 8);
+            image->VramUsed += tile.TextureBytes;
+            image->Resident.push_back(uploads[upload_n]);
+        }
+    }
+    if (uploads_count > 0)
+    {
+        std::lock_guard<std::mutex> lock(image->Mutex);
+        for (int upload_n = 0; upload_n < uploads_count; upload_n++)
+        {
+            ImGui_ImplDX7_Tile& tile = image->Tiles[uploads[upload_n]];
+            tile.State = tile.Texture ? ImGui_ImplDX7_TileState_Resident : ImGui_ImplDX7_TileState_Failed;
+        }
     }
 
-    // Restore application state.
-    backup.Restore(d3d);
+    // Release least recently used textures. Tiles displayed this frame and the last level (used as fallback) are kept.
+    if (image->VramUsed > image->VramBudget)
+    {
+        std::lock_guard<std::mutex> lock(image->Mutex);
+        std::sort(image->Resident.begin(), image->Resident.end(), [image](int a, int b) { return image->Tiles[a].LastUsedFrame < image->Tiles[b].LastUsedFrame; });
+        const int last_level_tile = image->LevelFirstTile[image->LevelsCount - 1];
+        int keep_count = 0;
+        for (int tile_n : image->Resident)
+        {
+            ImGui_ImplDX7_Tile& tile = image->Tiles[tile_n];
+            if (image->VramUsed > image->VramBudget && tile.LastUsedFrame != frame_count && tile_n != last_level_tile)
+            {
+                tile.Texture->Release();
+                tile.Texture = nullptr;
+                tile.State = ImGui_ImplDX7_TileState_Empty;
+                image->VramUsed -= tile.TextureBytes;
+                continue;
+            }
+            image->Resident[keep_count++] = tile_n;
+        }
+        image->Resident.resize(keep_count);
+    }
+}
+
+// Draw the part 'img_rect' (in level 0 pixels) of the image, using the texture of tile 'tile_n'.
+static void ImGui_ImplDX7_DrawTiledImageRect(ImDrawList* draw_list, const ImGui_ImplDX7_TiledImage* image, int tile_n, const ImRect& img_rect, const ImVec2& screen_origin, float zoom)
+{
+    int level, x, y, w, h;
+    ImGui_ImplDX7_GetTileRect(image, tile_n, &level, &x, &y, &w, &h);
+    const float uv_scale = 1.0f / (float)(IMGUI_DX7_TILE_SIZE << level);
+    const ImVec2 uv0((img_rect.Min.x - (float)(x << level)) * uv_scale, (img_rect.Min.y - (float)(y << level)) * uv_scale);
+    const ImVec2 uv1((img_rect.Max.x - (float)(x << level)) * uv_scale, (img_rect.Max.y - (float)(y << level)) * uv_scale);
+    draw_list->AddImage((ImTextureID)(intptr_t)image->Tiles[tile_n].Texture, screen_origin + img_rect.Min * zoom, screen_origin + img_rect.Max * zoom, uv0, uv1);
+}
+
+void ImGui_ImplDX7_TiledImageView(const char* str_id, ImGui_ImplDX7_TiledImage* image, const ImVec2& size_arg)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const ImVec2 avail = ImGui::GetContentRegionAvail();
+    const ImVec2 size = ImGui::CalcItemSize(size_arg, ImMax(avail.x, 4.0f), ImMax(avail.y, 4.0f));
+    const ImRect bb(ImGui::GetCursorScreenPos(), ImGui::GetCursorScreenPos() + size);
+    ImGui::InvisibleButton(str_id, size);
+    if (!ImGui::IsItemVisible())
+        return;
+
+    // Pan and zoom (around mouse cursor)
+    const ImVec2 image_size((float)image->Width, (float)image->Height);
+    const float zoom_fit = ImMin(size.x / image_size.x, size.y / image_size.y);
+    if (image->Zoom <= 0.0f || (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)))
+    {
+        image->Zoom = zoom_fit;
+        image->ViewCenter = image_size * 0.5f;
+    }
+    const ImVec2 bb_center = bb.GetCenter();
+    if (ImGui::IsItemActive())
+        image->ViewCenter -= io.MouseDelta / image->Zoom;
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::SetItemKeyOwner(ImGuiKey_MouseWheelY);
+        if (io.MouseWheel != 0.0f)
+        {
+            const ImVec2 mouse_img_pos = image->ViewCenter + (io.MousePos - bb_center) / image->Zoom;
+            image->Zoom = ImClamp(image->Zoom * powf(1.25f, io.MouseWheel), zoom_fit * 0.5f, 32.0f);
+            image->ViewCenter = mouse_img_pos - (io.MousePos - bb_center) / image->Zoom;
+        }
+    }
+    image->ViewCenter = ImClamp(image->ViewCenter, ImVec2(0.0f, 0.0f), image_size);
+
+    // Finest level with pixels not smaller than screen pixels
+    int level = 0;
+    while (level + 1 < image->LevelsCount && (float)(1 << (level + 1)) * image->Zoom <= 1.0f)
+        level++;
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddRectFilled(bb.Min, bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg));
+    draw_list->PushClipRect(bb.Min, bb.Max, true);
+
+    // Visible tiles, drawn with the texture of the closest coarser level while loading
+    const int frame_count = ImGui::GetFrameCount();
+    const ImVec2 screen_origin = bb_center - image->ViewCenter * image->Zoom;
+    const ImVec2 view_min = ImMax(image->ViewCenter - size * 0.5f / image->Zoom, ImVec2(0.0f, 0.0f));
+    const ImVec2 view_max = ImMin(image->ViewCenter + size * 0.5f / image->Zoom, image_size);
+    const int tile_extent = IMGUI_DX7_TILE_SIZE << level;
+    const int tx0 = (int)(view_min.x / tile_extent), tx1 = ImMin((int)(view_max.x / tile_extent), image->LevelTilesX[level] - 1);
+    const int ty0 = (int)(view_min.y / tile_extent), ty1 = ImMin((int)(view_max.y / tile_extent), image->LevelTilesY[level] - 1);
+    image->Wanted.clear();
+    for (int ty = ty0; ty <= ty1; ty++)
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            const int tile_n = ImGui_ImplDX7_GetTileIndex(image, level, tx, ty);
+            const ImRect tile_img_rect(ImVec2((float)(tx * tile_extent), (float)(ty * tile_extent)), ImMin(ImVec2((float)((tx + 1) * tile_extent), (float)((ty + 1) * tile_extent)), image_size));
+            image->Tiles[tile_n].LastUsedFrame = frame_count;
+            if (image->Tiles[tile_n].Texture)
+            {
+                ImGui_ImplDX7_DrawTiledImageRect(draw_list, image, tile_n, tile_img_rect, screen_origin, image->Zoom);
+                continue;
+            }
+            image->Wanted.push_back(tile_n);
+            for (int parent_level = level + 1; parent_level < image->LevelsCount; parent_level++)
+            {
+                const int parent_n = ImGui_ImplDX7_GetTileIndex(image, parent_level, tx >> (parent_level - level), ty >> (parent_level - level));
+                if (image->Tiles[parent_n].Texture == nullptr)
+                    continue;
+                image->Tiles[parent_n].LastUsedFrame = frame_count;
+                ImGui_ImplDX7_DrawTiledImageRect(draw_list, image, parent_n, tile_img_rect, screen_origin, image->Zoom);
+                break;
+            }
+        }
+    draw_list->PopClipRect();
+
+    // Request tiles closest to the center first, and always the last level (used as fallback for everything else).
+    auto tile_distance = [&](int tile_n) {
+        int tile_level, x, y, w, h;
+        ImGui_ImplDX7_GetTileRect(image, tile_n, &tile_level, &x, &y, &w, &h);
+        return ImLengthSqr(ImVec2((float)((x + w / 2) << tile_level), (float)((y + h / 2) << tile_level)) - image->ViewCenter);
+        };
+    std::sort(image->Wanted.begin(), image->Wanted.end(), [&](int a, int b) { return tile_distance(a) > tile_distance(b); });
+    const int last_level_tile = image->LevelFirstTile[image->LevelsCount - 1];
+    image->Tiles[last_level_tile].LastUsedFrame = frame_count;
+    if (image->Tiles[last_level_tile].Texture == nullptr && level != image->LevelsCount - 1)
+        image->Wanted.push_back(last_level_tile);
+
+    ImGui_ImplDX7_UpdateTiledImage(image, frame_count);
 }
 
 #endif // IMGUI_DISABLE
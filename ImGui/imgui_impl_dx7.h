@@ -10,8 +10,21 @@ IMGUI_IMPL_API bool ImGui_ImplDX7_Init(IDirect3DDevice7* device, IDirectDraw7* d
 IMGUI_IMPL_API void ImGui_ImplDX7_Shutdown();
 IMGUI_IMPL_API void ImGui_ImplDX7_NewFrame();
 IMGUI_IMPL_API void ImGui_ImplDX7_RenderDrawData(ImDrawData* draw_data);
+IMGUI_IMPL_API void ImGui_ImplDX7_RenderLastDrawData();    // Submit the last rendered frame again without clipping it (valid until the next ImGui::NewFrame()). Input is queued until then.
 
 IMGUI_IMPL_API bool ImGui_ImplDX7_CreateDeviceObjects();
 IMGUI_IMPL_API void ImGui_ImplDX7_InvalidateDeviceObjects();
 
+// Tiled image viewer, for images larger than the device texture size limit (e.g. 16k x 16k).
+// - The image is split into a pyramid of 256x256 tiles. Level 0 is full resolution, each next level is half the size of the previous one.
+// - Tiles needed for the visible region and zoom level are loaded on demand by 'load_tile', called on worker threads (possibly concurrently).
+//   It must write the w*h RGBA32 pixels (IM_COL32 layout) at (x,y) of the requested level, 'pitch' pixels apart. Level n is ceil(size / 2^n) pixels.
+// - Textures are created and uploaded on the render thread (a few per frame), and the least recently used ones are released when over 'vram_budget' bytes.
+// - While a tile is loading, a coarser level is displayed in its place.
+struct ImGui_ImplDX7_TiledImage;
+typedef bool (*ImGui_ImplDX7_LoadTileFunc)(void* user_data, int level, int x, int y, int w, int h, ImU32* out_pixels, int pitch);
+IMGUI_IMPL_API ImGui_ImplDX7_TiledImage* ImGui_ImplDX7_CreateTiledImage(int width, int height, ImGui_ImplDX7_LoadTileFunc load_tile, void* user_data, size_t vram_budget = 64 << 20, int worker_count = 2);
+IMGUI_IMPL_API void ImGui_ImplDX7_DestroyTiledImage(ImGui_ImplDX7_TiledImage* image);
+IMGUI_IMPL_API void ImGui_ImplDX7_TiledImageView(const char* str_id, ImGui_ImplDX7_TiledImage* image, const ImVec2& size = ImVec2(0, 0)); // Drag to pan, mouse wheel to zoom, double-click to fit.
+
 #endif
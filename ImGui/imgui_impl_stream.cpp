@@ -0,0 +1,849 @@
+// dear imgui: Draw data streaming (encoder + decoder)
+// ==================================================
+//
+// See imgui_impl_stream.h for usage.
+//
+// Packet layout (all integers little-endian, 'varint' = LEB128, 'svarint' = zigzag + LEB128)
+// ------------------------------------------------------------------------------------------
+//   u32    magic 'IMDS'
+//   u32    packet size in bytes, including this header
+//   u8     version
+//   u8     flags (1: key frame)
+//   f32x6  DisplayPos, DisplaySize, FramebufferScale
+//   varint texture message count, then for each:
+//            u8 op (1: create, 2: update, 3: destroy), varint texture id
+//            create: u8 format, varint width, varint height, pixels
+//            update: varint x, y, w, h, pixels
+//          pixels are zero-run encoded: repeat { varint zero_count, varint literal_count, literal bytes }
+//   varint draw list count, then for each:
+//            u32 hash, u8 mode (0: reuse list with same hash, 1: contents follow)
+//            contents: varint cmd count, cmds, varint vtx count, vertices, varint idx count, indices
+//            cmd: f32x4 clip rect, u8 tex kind (0: none, 1: texture id, 2: raw ImTextureID as u64), varint vtx offset, idx offset, elem count
+//            vertex: svarint dx, dy (1/16 px), svarint du, dv (1/65536), varint color xor previous color
+//            index: svarint delta from previous index
+//
+// Draw lists are reused by hash of their exact contents. Both sides only remember the lists of the previous frame.
+//
+// ---------------------------------------------------------------------------
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_stream.h"
+#include "imgui_internal.h"
+
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#endif
+
+#define IMGUI_STREAM_MAGIC          0x53444D49  // 'IMDS'
+#define IMGUI_STREAM_VERSION        1
+#define IMGUI_STREAM_HEADER_SIZE    (4 + 4 + 1 + 1 + 6 * 4)
+#define IMGUI_STREAM_POS_SCALE      16.0f
+#define IMGUI_STREAM_UV_SCALE       65536.0f
+
+enum ImGui_ImplStream_TexOp_ { ImGui_ImplStream_TexOp_Create = 1, ImGui_ImplStream_TexOp_Update = 2, ImGui_ImplStream_TexOp_Destroy = 3 };
+
+//------------------------------------------------------------------------------
+// Serialization helpers
+//------------------------------------------------------------------------------
+
+static void StreamWriteU8(ImVector<unsigned char>* buf, unsigned int v)   { buf->push_back((unsigned char)v); }
+static void StreamWriteU32(ImVector<unsigned char>* buf, ImU32 v)         { for (int n = 0; n < 4; n++) buf->push_back((unsigned char)(v >> (n * 8))); }
+static void StreamWriteF32(ImVector<unsigned char>* buf, float v)         { ImU32 u; memcpy(&u, &v, 4); StreamWriteU32(buf, u); }
+static void StreamWriteVarint(ImVector<unsigned char>* buf, ImU64 v)      { while (v >= 0x80) { buf->push_back((unsigned char)(v | 0x80)); v >>= 7; } buf->push_back((unsigned char)v); }
+static void StreamWriteSVarint(ImVector<unsigned char>* buf, int v)       { StreamWriteVarint(buf, ((ImU32)v << 1) ^ (ImU32)(v >> 31)); }
+
+struct ImGui_ImplStream_Reader
+{
+    const unsigned char*    P;
+    const unsigned char*    End;
+    bool                    Error;
+
+    ImGui_ImplStream_Reader(const void* data, int size) { P = (const unsigned char*)data; End = P + size; Error = false; }
+    bool    Need(ImU64 n)   { if (Error || (ImU64)(End - P) < n) { Error = true; return false; } return true; }
+    ImU32   ReadU8()        { if (!Need(1)) return 0; return *P++; }
+    ImU32   ReadU32()       { if (!Need(4)) return 0; ImU32 v = P[0] | (P[1] << 8) | (P[2] << 16) | ((ImU32)P[3] << 24); P += 4; return v; }
+    float   ReadF32()       { ImU32 u = ReadU32(); float v; memcpy(&v, &u, 4); return v; }
+    ImU64   ReadVarint()
+    {
+        ImU64 v = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (!Need(1))
+                return 0;
+            unsigned char b = *P++;
+            v |= (ImU64)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                return v;
+        }
+        Error = true;
+        return 0;
+    }
+    int     ReadSVarint()   { ImU32 u = (ImU32)ReadVarint(); return (int)(u >> 1) ^ -(int)(u & 1); }
+    int     ReadCount(int max_count) { ImU64 v = ReadVarint(); if (v > (ImU64)max_count) { Error = true; return 0; } return (int)v; }
+};
+
+static inline int StreamQuantize(float v, float scale)
+{
+    float q = v * scale;
+    q = ImClamp(q, -1073741823.0f, 1073741823.0f); // Keep zigzag encoding of deltas within 32-bit
+    return (int)(q < 0.0f ? q - 0.5f : q + 0.5f);
+}
+
+// Zero-run encoding: texture atlases are mostly empty, especially when created.
+static void StreamWritePixels(ImVector<unsigned char>* buf, const unsigned char* src, int size)
+{
+    const unsigned char* p = src;
+    const unsigned char* end = src + size;
+    while (p < end)
+    {
+        const unsigned char* zeros_end = p;
+        while (zeros_end < end && *zeros_end == 0)
+            zeros_end++;
+        const unsigned char* literal_end = zeros_end;
+        while (literal_end < end && !(literal_end + 4 <= end && literal_end[0] == 0 && literal_end[1] == 0 && literal_end[2] == 0 && literal_end[3] == 0))
+            literal_end++;
+        StreamWriteVarint(buf, (ImU64)(zeros_end - p));
+        StreamWriteVarint(buf, (ImU64)(literal_end - zeros_end));
+        if (literal_end > zeros_end)
+        {
+            const int literal_size = (int)(literal_end - zeros_end);
+            buf->resize(buf->Size + literal_size);
+            memcpy(buf->Data + buf->Size - literal_size, zeros_end, (size_t)literal_size);
+        }
+        p = literal_end;
+    }
+}
+
+static bool StreamReadPixels(ImGui_ImplStream_Reader* r, unsigned char* dst, int size)
+{
+    int n = 0;
+    while (n < size && !r->Error)
+    {
+        const int zeros = r->ReadCount(size - n);
+        memset(dst + n, 0, (size_t)zeros);
+        n += zeros;
+        const int literals = r->ReadCount(size - n);
+        if (!r->Need(literals))
+            break;
+        memcpy(dst + n, r->P, (size_t)literals);
+        r->P += literals;
+        n += literals;
+    }
+    return !r->Error;
+}
+
+//------------------------------------------------------------------------------
+// Encoder
+//------------------------------------------------------------------------------
+
+struct ImGui_ImplStream_Data
+{
+    int                     NextTexId;
+    bool                    WantKeyFrame;
+    ImVector<ImU32>         PrevHashes;         // Hashes of draw lists held by the decoder (sent last frame)
+    ImVector<ImU32>         CurrHashes;
+    ImVector<unsigned char> TempPixels;
+    ImGui_ImplStream_Stats  Stats;
+
+    ImGui_ImplStream_Data() { NextTexId = 1; WantKeyFrame = true; memset(&Stats, 0, sizeof(Stats)); }
+};
+
+static ImGui_ImplStream_Data* ImGui_ImplStream_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplStream_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+bool ImGui_ImplStream_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Renderer backend already initialized.");
+
+    ImGui_ImplStream_Data* bd = IM_NEW(ImGui_ImplStream_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_stream";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures;
+    return true;
+}
+
+void ImGui_ImplStream_Shutdown()
+{
+    ImGui_ImplStream_Data* bd = ImGui_ImplStream_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Textures only exist in the stream: forget about them.
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplStream_NewFrame()
+{
+    ImGui_ImplStream_Data* bd = ImGui_ImplStream_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplStream_Init()?");
+    IM_UNUSED(bd);
+}
+
+void ImGui_ImplStream_RequestKeyFrame()
+{
+    ImGui_ImplStream_Data* bd = ImGui_ImplStream_GetBackendData();
+    bd->WantKeyFrame = true;
+}
+
+const ImGui_ImplStream_Stats* ImGui_ImplStream_GetStats()
+{
+    ImGui_ImplStream_Data* bd = ImGui_ImplStream_GetBackendData();
+    return &bd->Stats;
+}
+
+static void ImGui_ImplStream_WriteTextureRect(ImGui_ImplStream_Data* bd, ImVector<unsigned char>* buf, ImTextureData* tex, int x, int y, int w, int h)
+{
+    const int row_size = w * tex->BytesPerPixel;
+    bd->TempPixels.resize(row_size * h);
+    for (int row = 0; row < h; row++)
+        memcpy(bd->TempPixels.Data + row * row_size, tex->GetPixelsAt(x, y + row), (size_t)row_size);
+    StreamWritePixels(buf, bd->TempPixels.Data, bd->TempPixels.Size);
+}
+
+// Returns number of texture messages written
+// Key frames send every live texture in full, whatever its status: a decoder joining then has never seen them.
+static int ImGui_ImplStream_EncodeTexture(ImGui_ImplStream_Data* bd, ImVector<unsigned char>* buf, ImTextureData* tex, bool key_frame)
+{
+    const bool is_live = tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates || (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames == 0);
+    if (tex->Status == ImTextureStatus_WantCreate || (key_frame && is_live))
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+            tex->SetTexID((ImTextureID)(ImU64)bd->NextTexId++);
+        StreamWriteU8(buf, ImGui_ImplStream_TexOp_Create);
+        StreamWriteVarint(buf, (ImU64)tex->GetTexID());
+        StreamWriteU8(buf, (unsigned int)tex->Format);
+        StreamWriteVarint(buf, (ImU64)tex->Width);
+        StreamWriteVarint(buf, (ImU64)tex->Height);
+        StreamWritePixels(buf, (const unsigned char*)tex->GetPixels(), tex->GetSizeInBytes()); // Include pending updates, already applied to pixels
+        if (tex->Status != ImTextureStatus_WantDestroy) // Still referenced this frame: destroyed on a later frame
+            tex->SetStatus(ImTextureStatus_OK);
+        return 1;
+    }
+    if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        for (const ImTextureRect& r : tex->Updates)
+        {
+            StreamWriteU8(buf, ImGui_ImplStream_TexOp_Update);
+            StreamWriteVarint(buf, (ImU64)tex->GetTexID());
+            StreamWriteVarint(buf, r.x);
+            StreamWriteVarint(buf, r.y);
+            StreamWriteVarint(buf, r.w);
+            StreamWriteVarint(buf, r.h);
+            ImGui_ImplStream_WriteTextureRect(bd, buf, tex, r.x, r.y, r.w, r.h);
+        }
+        tex->SetStatus(ImTextureStatus_OK);
+        return tex->Updates.Size;
+    }
+    if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+    {
+        StreamWriteU8(buf, ImGui_ImplStream_TexOp_Destroy);
+        StreamWriteVarint(buf, (ImU64)tex->GetTexID());
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+        return 1;
+    }
+    return 0;
+}
+
+struct ImGui_ImplStream_CmdKey
+{
+    ImVec4          ClipRect;
+    ImU64           TexID;
+    unsigned int    VtxOffset;
+    unsigned int    IdxOffset;
+    unsigned int    ElemCount;
+};
+
+static ImU32 ImGui_ImplStream_HashDrawList(const ImDrawList* draw_list)
+{
+    ImU32 hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), (ImU32)draw_list->VtxBuffer.Size);
+    hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        ImGui_ImplStream_CmdKey key;
+        memset((void*)&key, 0, sizeof(key)); // Clear padding
+        key.ClipRect = cmd.ClipRect;
+        key.TexID = (ImU64)cmd.GetTexID();
+        key.VtxOffset = cmd.VtxOffset;
+        key.IdxOffset = cmd.IdxOffset;
+        key.ElemCount = cmd.UserCallback ? 0 : cmd.ElemCount;
+        hash = ImHashData(&key, sizeof(key), hash);
+    }
+    return hash;
+}
+
+static void ImGui_ImplStream_EncodeDrawList(ImGui_ImplStream_Data* bd, ImVector<unsigned char>* buf, const ImDrawList* draw_list)
+{
+    int cmd_count = 0;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        if (cmd.UserCallback == nullptr)
+            cmd_count++;
+    StreamWriteVarint(buf, (ImU64)cmd_count);
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback != nullptr)
+            continue;
+        StreamWriteF32(buf, cmd.ClipRect.x);
+        StreamWriteF32(buf, cmd.ClipRect.y);
+        StreamWriteF32(buf, cmd.ClipRect.z);
+        StreamWriteF32(buf, cmd.ClipRect.w);
+        if (cmd.TexRef._TexData != nullptr)
+        {
+            StreamWriteU8(buf, 1);
+            StreamWriteVarint(buf, (ImU64)cmd.TexRef._TexData->TexID);
+        }
+        else if (cmd.TexRef._TexID != ImTextureID_Invalid)
+        {
+            StreamWriteU8(buf, 2);
+            const ImU64 raw_id = (ImU64)cmd.TexRef._TexID;
+            StreamWriteU32(buf, (ImU32)raw_id);
+            StreamWriteU32(buf, (ImU32)(raw_id >> 32));
+        }
+        else
+        {
+            StreamWriteU8(buf, 0);
+        }
+        StreamWriteVarint(buf, cmd.VtxOffset);
+        StreamWriteVarint(buf, cmd.IdxOffset);
+        StreamWriteVarint(buf, cmd.ElemCount);
+    }
+
+    // Vertices: delta encode quantized values against previous vertex
+    StreamWriteVarint(buf, (ImU64)draw_list->VtxBuffer.Size);
+    int prev_x = 0, prev_y = 0, prev_u = 0, prev_v = 0;
+    ImU32 prev_col = 0;
+    for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+    {
+        const int x = StreamQuantize(vtx.pos.x, IMGUI_STREAM_POS_SCALE);
+        const int y = StreamQuantize(vtx.pos.y, IMGUI_STREAM_POS_SCALE);
+        const ImVec2 uv = vtx.uv;
+        const int u = StreamQuantize(uv.x, IMGUI_STREAM_UV_SCALE);
+        const int v = StreamQuantize(uv.y, IMGUI_STREAM_UV_SCALE);
+        StreamWriteSVarint(buf, x - prev_x);
+        StreamWriteSVarint(buf, y - prev_y);
+        StreamWriteSVarint(buf, u - prev_u);
+        StreamWriteSVarint(buf, v - prev_v);
+        StreamWriteVarint(buf, vtx.col ^ prev_col);
+        prev_x = x; prev_y = y; prev_u = u; prev_v = v;
+        prev_col = vtx.col;
+    }
+
+    // Indices: delta encode against previous index
+    StreamWriteVarint(buf, (ImU64)draw_list->IdxBuffer.Size);
+    int prev_idx = 0;
+    for (ImDrawIdx idx : draw_list->IdxBuffer)
+    {
+        StreamWriteSVarint(buf, (int)idx - prev_idx);
+        prev_idx = (int)idx;
+    }
+
+    ImGui_ImplStream_Stats& stats = bd->Stats;
+    stats.DrawListsSent++;
+    stats.VtxCount += draw_list->VtxBuffer.Size;
+    stats.IdxCount += draw_list->IdxBuffer.Size;
+    stats.RawBytes += draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert) + draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx) + cmd_count * (int)sizeof(ImDrawCmd);
+}
+
+void ImGui_ImplStream_EncodeDrawData(ImDrawData* draw_data, ImVector<unsigned char>* out_packet)
+{
+    ImGui_ImplStream_Data* bd = ImGui_ImplStream_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplStream_Init()?");
+    ImGui_ImplStream_Stats& stats = bd->Stats;
+    const bool key_frame = bd->WantKeyFrame;
+    bd->WantKeyFrame = false;
+    stats.TextureBytes = stats.DrawListsSent = stats.DrawListsReused = stats.VtxCount = stats.IdxCount = stats.RawBytes = 0;
+
+    const int packet_start = out_packet->Size;
+    StreamWriteU32(out_packet, IMGUI_STREAM_MAGIC);
+    StreamWriteU32(out_packet, 0); // Patched below
+    StreamWriteU8(out_packet, IMGUI_STREAM_VERSION);
+    StreamWriteU8(out_packet, key_frame ? 1 : 0);
+    StreamWriteF32(out_packet, draw_data->DisplayPos.x);
+    StreamWriteF32(out_packet, draw_data->DisplayPos.y);
+    StreamWriteF32(out_packet, draw_data->DisplaySize.x);
+    StreamWriteF32(out_packet, draw_data->DisplaySize.y);
+    StreamWriteF32(out_packet, draw_data->FramebufferScale.x);
+    StreamWriteF32(out_packet, draw_data->FramebufferScale.y);
+
+    // Textures. Messages are written to a temporary buffer as we only know their count afterward.
+    // Textures are processed first so that new texture identifiers are known when encoding draw commands.
+    {
+        ImVector<unsigned char> tex_buf;
+        int tex_msg_count = 0;
+        if (draw_data->Textures != nullptr)
+            for (ImTextureData* tex : *draw_data->Textures)
+                tex_msg_count += ImGui_ImplStream_EncodeTexture(bd, &tex_buf, tex, key_frame);
+        const int tex_start = out_packet->Size;
+        StreamWriteVarint(out_packet, (ImU64)tex_msg_count);
+        if (tex_buf.Size > 0)
+        {
+            out_packet->resize(out_packet->Size + tex_buf.Size);
+            memcpy(out_packet->Data + out_packet->Size - tex_buf.Size, tex_buf.Data, (size_t)tex_buf.Size);
+        }
+        stats.TextureBytes = out_packet->Size - tex_start;
+    }
+
+    // Draw lists
+    if (key_frame)
+        bd->PrevHashes.resize(0);
+    bd->CurrHashes.resize(0);
+    StreamWriteVarint(out_packet, (ImU64)draw_data->CmdLists.Size);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        const ImU32 hash = ImGui_ImplStream_HashDrawList(draw_list);
+        const bool reuse = bd->PrevHashes.contains(hash) || bd->CurrHashes.contains(hash);
+        StreamWriteU32(out_packet, hash);
+        StreamWriteU8(out_packet, reuse ? 0 : 1);
+        if (reuse)
+            stats.DrawListsReused++;
+        else
+            ImGui_ImplStream_EncodeDrawList(bd, out_packet, draw_list);
+        bd->CurrHashes.push_back(hash);
+    }
+    bd->PrevHashes.swap(bd->CurrHashes);
+
+    // Patch packet size
+    const ImU32 packet_size = (ImU32)(out_packet->Size - packet_start);
+    for (int n = 0; n < 4; n++)
+        out_packet->Data[packet_start + 4 + n] = (unsigned char)(packet_size >> (n * 8));
+    stats.FrameBytes = (int)packet_size;
+    stats.TotalBytes += packet_size;
+    stats.TotalFrames++;
+}
+
+//------------------------------------------------------------------------------
+// Decoder
+//------------------------------------------------------------------------------
+
+struct ImGui_ImplStream_DecoderList
+{
+    ImU32           Hash;
+    ImDrawList*     DrawList;
+};
+
+struct ImGui_ImplStream_DecoderTexture
+{
+    ImU64           Id;
+    ImTextureData*  Tex;
+};
+
+struct ImGui_ImplStream_Decoder
+{
+    ImDrawData                                  DrawData;
+    ImVector<ImGui_ImplStream_DecoderList>      PrevLists;      // Lists decoded last frame, available for reuse
+    ImVector<ImGui_ImplStream_DecoderList>      CurrLists;
+    ImVector<ImDrawList*>                       FreeLists;      // Pool to avoid reallocating buffers
+    ImVector<ImGui_ImplStream_DecoderTexture>   TexIds;         // Live textures by stream id
+    ImVector<ImTextureData*>                    Textures;       // All textures, including those waiting for the backend to destroy them
+    bool                                        WaitKeyFrame;
+};
+
+ImGui_ImplStream_Decoder* ImGui_ImplStream_CreateDecoder()
+{
+    ImGui_ImplStream_Decoder* decoder = IM_NEW(ImGui_ImplStream_Decoder)();
+    decoder->WaitKeyFrame = true;
+    decoder->DrawData.Textures = &decoder->Textures;
+    return decoder;
+}
+
+void ImGui_ImplStream_DestroyDecoder(ImGui_ImplStream_Decoder* decoder)
+{
+    for (ImGui_ImplStream_DecoderList& entry : decoder->PrevLists)
+        IM_DELETE(entry.DrawList);
+    for (ImGui_ImplStream_DecoderList& entry : decoder->CurrLists)
+        IM_DELETE(entry.DrawList);
+    for (ImDrawList* draw_list : decoder->FreeLists)
+        IM_DELETE(draw_list);
+    for (ImTextureData* tex : decoder->Textures)
+        IM_DELETE(tex);
+    IM_DELETE(decoder);
+}
+
+ImDrawData* ImGui_ImplStream_GetDrawData(ImGui_ImplStream_Decoder* decoder)
+{
+    return &decoder->DrawData;
+}
+
+void ImGui_ImplStream_DecoderReleaseTextures(ImGui_ImplStream_Decoder* decoder)
+{
+    for (ImTextureData* tex : decoder->Textures)
+        if (tex->Status != ImTextureStatus_Destroyed)
+        {
+            tex->WantDestroyNextFrame = true;
+            tex->UnusedFrames = 1;
+            tex->SetStatus((tex->Status == ImTextureStatus_WantCreate) ? ImTextureStatus_Destroyed : ImTextureStatus_WantDestroy);
+        }
+    decoder->TexIds.resize(0);
+    decoder->DrawData.CmdLists.resize(0);
+    decoder->DrawData.CmdListsCount = decoder->DrawData.TotalVtxCount = decoder->DrawData.TotalIdxCount = 0;
+    decoder->WaitKeyFrame = true;
+}
+
+static ImTextureData* ImGui_ImplStream_DecoderFindTexture(ImGui_ImplStream_Decoder* decoder, ImU64 id)
+{
+    for (ImGui_ImplStream_DecoderTexture& entry : decoder->TexIds)
+        if (entry.Id == id)
+            return entry.Tex;
+    return nullptr;
+}
+
+static void ImGui_ImplStream_DecoderForgetTexture(ImGui_ImplStream_Decoder* decoder, ImU64 id)
+{
+    for (ImGui_ImplStream_DecoderTexture& entry : decoder->TexIds)
+        if (entry.Id == id)
+        {
+            ImTextureData* tex = entry.Tex;
+            tex->WantDestroyNextFrame = true;
+            tex->UnusedFrames = 1;
+            tex->SetStatus((tex->Status == ImTextureStatus_WantCreate) ? ImTextureStatus_Destroyed : ImTextureStatus_WantDestroy);
+            decoder->TexIds.erase(&entry);
+            return;
+        }
+}
+
+// Same bookkeeping as ImFontAtlasUpdateNewFrame() does for atlas textures.
+static void ImGui_ImplStream_DecoderUpdateTextures(ImGui_ImplStream_Decoder* decoder)
+{
+    for (int tex_n = 0; tex_n < decoder->Textures.Size; tex_n++)
+    {
+        ImTextureData* tex = decoder->Textures[tex_n];
+        if (tex->Status == ImTextureStatus_OK)
+        {
+            tex->Updates.resize(0);
+            tex->UpdateRect.x = tex->UpdateRect.y = (unsigned short)~0;
+            tex->UpdateRect.w = tex->UpdateRect.h = 0;
+        }
+        if (tex->Status == ImTextureStatus_Destroyed)
+        {
+            if (tex->WantDestroyNextFrame)
+            {
+                IM_DELETE(tex);
+                decoder->Textures.erase(decoder->Textures.Data + tex_n);
+                tex_n--;
+                continue;
+            }
+            tex->SetStatus(ImTextureStatus_WantCreate); // Destroyed by backend (e.g. device lost): create again
+        }
+    }
+}
+
+static bool ImGui_ImplStream_DecodeTextureMessage(ImGui_ImplStream_Decoder* decoder, ImGui_ImplStream_Reader* r)
+{
+    const ImU32 op = r->ReadU8();
+    const ImU64 id = r->ReadVarint();
+    if (op == ImGui_ImplStream_TexOp_Create)
+    {
+        const ImTextureFormat format = (ImTextureFormat)r->ReadU8();
+        const int w = r->ReadCount(0xFFFF); // ImTextureRect fields are 'unsigned short'
+        const int h = r->ReadCount(0xFFFF);
+        if (r->Error || (format != ImTextureFormat_RGBA32 && format != ImTextureFormat_Alpha8) || w == 0 || h == 0)
+            return false;
+        if ((ImU64)w * (ImU64)h * (format == ImTextureFormat_RGBA32 ? 4 : 1) > 0x7FFFFFFF) // ImTextureData sizes are 'int'
+            return false;
+        ImTextureData* tex = ImGui_ImplStream_DecoderFindTexture(decoder, id);
+        if (tex != nullptr && (tex->Format != format || tex->Width != w || tex->Height != h || tex->Status == ImTextureStatus_WantDestroy))
+        {
+            ImGui_ImplStream_DecoderForgetTexture(decoder, id);
+            tex = nullptr;
+        }
+        if (tex == nullptr)
+        {
+            tex = IM_NEW(ImTextureData)();
+            tex->Create(format, w, h);
+            tex->UniqueID = (int)id;
+            tex->RefCount = 1;
+            tex->SetStatus(ImTextureStatus_WantCreate);
+            decoder->Textures.push_back(tex);
+            ImGui_ImplStream_DecoderTexture entry = { id, tex };
+            decoder->TexIds.push_back(entry);
+        }
+        else if (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates)
+        {
+            // Key frame for a texture we already have: upload everything again.
+            ImTextureRect full_rect = { 0, 0, (unsigned short)w, (unsigned short)h };
+            tex->Updates.resize(0);
+            tex->Updates.push_back(full_rect);
+            tex->UpdateRect = full_rect;
+            tex->SetStatus(ImTextureStatus_WantUpdates);
+        }
+        tex->UsedRect.x = tex->UsedRect.y = 0;
+        tex->UsedRect.w = (unsigned short)w;
+        tex->UsedRect.h = (unsigned short)h;
+        return StreamReadPixels(r, tex->Pixels, tex->GetSizeInBytes());
+    }
+    if (op == ImGui_ImplStream_TexOp_Update)
+    {
+        ImTextureRect req;
+        req.x = (unsigned short)r->ReadCount(0xFFFF);
+        req.y = (unsigned short)r->ReadCount(0xFFFF);
+        req.w = (unsigned short)r->ReadCount(0xFFFF);
+        req.h = (unsigned short)r->ReadCount(0xFFFF);
+        ImTextureData* tex = ImGui_ImplStream_DecoderFindTexture(decoder, id);
+        if (r->Error || tex == nullptr || req.x + req.w > tex->Width || req.y + req.h > tex->Height)
+            return false;
+        const int row_size = req.w * tex->BytesPerPixel;
+        ImVector<unsigned char> pixels;
+        pixels.resize(row_size * req.h);
+        if (!StreamReadPixels(r, pixels.Data, pixels.Size))
+            return false;
+        for (int row = 0; row < req.h; row++)
+            memcpy(tex->GetPixelsAt(req.x, req.y + row), pixels.Data + row * row_size, (size_t)row_size);
+        if (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates)
+        {
+            const int new_x1 = ImMax(tex->UpdateRect.w == 0 ? 0 : tex->UpdateRect.x + tex->UpdateRect.w, req.x + req.w);
+            const int new_y1 = ImMax(tex->UpdateRect.h == 0 ? 0 : tex->UpdateRect.y + tex->UpdateRect.h, req.y + req.h);
+            tex->UpdateRect.x = ImMin(tex->UpdateRect.x, req.x);
+            tex->UpdateRect.y = ImMin(tex->UpdateRect.y, req.y);
+            tex->UpdateRect.w = (unsigned short)(new_x1 - tex->UpdateRect.x);
+            tex->UpdateRect.h = (unsigned short)(new_y1 - tex->UpdateRect.y);
+            tex->Updates.push_back(req);
+            tex->SetStatus(ImTextureStatus_WantUpdates);
+        }
+        return true;
+    }
+    if (op == ImGui_ImplStream_TexOp_Destroy)
+    {
+        ImGui_ImplStream_DecoderForgetTexture(decoder, id);
+        return !r->Error;
+    }
+    return false;
+}
+
+static ImDrawList* ImGui_ImplStream_DecoderAllocList(ImGui_ImplStream_Decoder* decoder)
+{
+    if (decoder->FreeLists.Size > 0)
+    {
+        ImDrawList* draw_list = decoder->FreeLists.back();
+        decoder->FreeLists.pop_back();
+        return draw_list;
+    }
+    return IM_NEW(ImDrawList)(nullptr);
+}
+
+static bool ImGui_ImplStream_DecodeDrawList(ImGui_ImplStream_Decoder* decoder, ImGui_ImplStream_Reader* r, ImDrawList* draw_list)
+{
+    const int cmd_count = r->ReadCount(0x7FFFFFF);
+    if (!r->Need((ImU64)cmd_count * (16 + 1 + 3))) // Sizes computed in 64-bit: counts come from the stream
+        return false;
+    draw_list->CmdBuffer.resize(cmd_count);
+    for (ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        cmd = ImDrawCmd();
+        cmd.ClipRect.x = r->ReadF32();
+        cmd.ClipRect.y = r->ReadF32();
+        cmd.ClipRect.z = r->ReadF32();
+        cmd.ClipRect.w = r->ReadF32();
+        const ImU32 tex_kind = r->ReadU8();
+        if (tex_kind == 1)
+        {
+            const ImU64 id = r->ReadVarint();
+            cmd.TexRef._TexData = ImGui_ImplStream_DecoderFindTexture(decoder, id);
+            if (cmd.TexRef._TexData == nullptr)
+                return false;
+        }
+        else if (tex_kind == 2)
+        {
+            const ImU64 lo = r->ReadU32();
+            const ImU64 hi = r->ReadU32();
+            cmd.TexRef._TexID = (ImTextureID)(lo | (hi << 32));
+        }
+        cmd.VtxOffset = (unsigned int)r->ReadVarint();
+        cmd.IdxOffset = (unsigned int)r->ReadVarint();
+        cmd.ElemCount = (unsigned int)r->ReadVarint();
+    }
+
+    const int vtx_count = r->ReadCount(0x7FFFFFF);
+    if (!r->Need((ImU64)vtx_count * 5))
+        return false;
+    draw_list->VtxBuffer.resize(vtx_count);
+    ImU32 x = 0, y = 0, u = 0, v = 0; // Unsigned so that deltas of a corrupted stream wrap instead of overflowing
+    ImU32 col = 0;
+    for (ImDrawVert& vtx : draw_list->VtxBuffer)
+    {
+        x += (ImU32)r->ReadSVarint();
+        y += (ImU32)r->ReadSVarint();
+        u += (ImU32)r->ReadSVarint();
+        v += (ImU32)r->ReadSVarint();
+        col ^= (ImU32)r->ReadVarint();
+        vtx.pos = ImVec2((float)(int)x / IMGUI_STREAM_POS_SCALE, (float)(int)y / IMGUI_STREAM_POS_SCALE);
+        vtx.uv = ImVec2((float)(int)u / IMGUI_STREAM_UV_SCALE, (float)(int)v / IMGUI_STREAM_UV_SCALE);
+        vtx.col = col;
+    }
+
+    const int idx_count = r->ReadCount(0x7FFFFFF);
+    if (!r->Need((ImU64)idx_count))
+        return false;
+    draw_list->IdxBuffer.resize(idx_count);
+    ImU32 idx = 0;
+    for (ImDrawIdx& dst_idx : draw_list->IdxBuffer)
+    {
+        idx += (ImU32)r->ReadSVarint();
+        dst_idx = (ImDrawIdx)idx;
+    }
+    if (r->Error)
+        return false;
+
+    // Validate ranges, so a corrupted stream can't make a renderer backend read out of bounds.
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if ((ImU64)cmd.IdxOffset + cmd.ElemCount > (ImU64)idx_count)
+            return false;
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            if ((ImU64)cmd.VtxOffset + draw_list->IdxBuffer.Data[cmd.IdxOffset + n] >= (ImU64)vtx_count)
+                return false;
+    }
+    return true;
+}
+
+static ImDrawList* ImGui_ImplStream_DecoderReuseList(ImGui_ImplStream_Decoder* decoder, ImU32 hash)
+{
+    for (ImGui_ImplStream_DecoderList& entry : decoder->PrevLists)
+        if (entry.Hash == hash && entry.DrawList != nullptr)
+        {
+            ImDrawList* draw_list = entry.DrawList;
+            entry.DrawList = nullptr;
+            return draw_list;
+        }
+
+    // Same contents used twice (in previous or current frame): make a copy
+    for (ImGui_ImplStream_DecoderList& entry : decoder->CurrLists)
+        if (entry.Hash == hash)
+        {
+            ImDrawList* draw_list = ImGui_ImplStream_DecoderAllocList(decoder);
+            draw_list->CmdBuffer = entry.DrawList->CmdBuffer;
+            draw_list->IdxBuffer = entry.DrawList->IdxBuffer;
+            draw_list->VtxBuffer = entry.DrawList->VtxBuffer;
+            return draw_list;
+        }
+    return nullptr;
+}
+
+static void ImGui_ImplStream_DecoderReset(ImGui_ImplStream_Decoder* decoder)
+{
+    for (ImGui_ImplStream_DecoderList& entry : decoder->CurrLists)
+        decoder->FreeLists.push_back(entry.DrawList);
+    decoder->CurrLists.resize(0);
+    for (ImGui_ImplStream_DecoderList& entry : decoder->PrevLists)
+        if (entry.DrawList != nullptr)
+            decoder->FreeLists.push_back(entry.DrawList);
+    decoder->PrevLists.resize(0);
+    decoder->DrawData.CmdLists.resize(0);
+    decoder->DrawData.CmdListsCount = decoder->DrawData.TotalVtxCount = decoder->DrawData.TotalIdxCount = 0;
+    decoder->WaitKeyFrame = true;
+}
+
+int ImGui_ImplStream_DecodeFrame(ImGui_ImplStream_Decoder* decoder, const void* data, int data_size)
+{
+    if (data_size < 8)
+        return 0;
+    ImGui_ImplStream_Reader r(data, data_size);
+    if (r.ReadU32() != IMGUI_STREAM_MAGIC)
+        return -1;
+    const ImU32 packet_size = r.ReadU32();
+    if (packet_size < IMGUI_STREAM_HEADER_SIZE || packet_size > 0x7FFFFFFF)
+        return -1;
+    if ((ImU32)data_size < packet_size)
+        return 0;
+    r.End = (const unsigned char*)data + packet_size;
+
+    const ImU32 version = r.ReadU8();
+    const bool key_frame = (r.ReadU8() & 1) != 0;
+    if (version != IMGUI_STREAM_VERSION)
+        return -1;
+    if (decoder->WaitKeyFrame && !key_frame)
+        return (int)packet_size; // Skip packets until we can synchronize
+    decoder->WaitKeyFrame = false;
+
+    ImDrawData* draw_data = &decoder->DrawData;
+    draw_data->DisplayPos.x = r.ReadF32();
+    draw_data->DisplayPos.y = r.ReadF32();
+    draw_data->DisplaySize.x = r.ReadF32();
+    draw_data->DisplaySize.y = r.ReadF32();
+    draw_data->FramebufferScale.x = r.ReadF32();
+    draw_data->FramebufferScale.y = r.ReadF32();
+
+    // Textures
+    ImGui_ImplStream_DecoderUpdateTextures(decoder);
+    const int tex_msg_count = r.ReadCount(0x7FFFFFF);
+    for (int n = 0; n < tex_msg_count; n++)
+        if (!ImGui_ImplStream_DecodeTextureMessage(decoder, &r))
+        {
+            ImGui_ImplStream_DecoderReset(decoder);
+            return -1;
+        }
+
+    // Draw lists
+    if (key_frame)
+        ImGui_ImplStream_DecoderReset(decoder);
+    decoder->WaitKeyFrame = false;
+    const int list_count = r.ReadCount(0x7FFFFFF);
+    decoder->CurrLists.resize(0);
+    for (int n = 0; n < list_count && !r.Error; n++)
+    {
+        const ImU32 hash = r.ReadU32();
+        const ImU32 mode = r.ReadU8();
+        ImDrawList* draw_list = nullptr;
+        if (mode == 0)
+        {
+            draw_list = ImGui_ImplStream_DecoderReuseList(decoder, hash);
+        }
+        else if (mode == 1)
+        {
+            draw_list = ImGui_ImplStream_DecoderAllocList(decoder);
+            if (!ImGui_ImplStream_DecodeDrawList(decoder, &r, draw_list))
+            {
+                decoder->FreeLists.push_back(draw_list);
+                draw_list = nullptr;
+            }
+        }
+        if (draw_list == nullptr)
+        {
+            ImGui_ImplStream_DecoderReset(decoder);
+            return -1;
+        }
+        ImGui_ImplStream_DecoderList entry = { hash, draw_list };
+        decoder->CurrLists.push_back(entry);
+    }
+    if (r.Error)
+    {
+        ImGui_ImplStream_DecoderReset(decoder);
+        return -1;
+    }
+
+    // Recycle lists which were not reused, keep current ones for next frame
+    for (ImGui_ImplStream_DecoderList& entry : decoder->PrevLists)
+        if (entry.DrawList != nullptr)
+            decoder->FreeLists.push_back(entry.DrawList);
+    decoder->PrevLists.swap(decoder->CurrLists);
+    decoder->CurrLists.resize(0);
+
+    draw_data->Valid = true;
+    draw_data->CmdLists.resize(0);
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    for (ImGui_ImplStream_DecoderList& entry : decoder->PrevLists)
+    {
+        draw_data->CmdLists.push_back(entry.DrawList);
+        draw_data->TotalVtxCount += entry.DrawList->VtxBuffer.Size;
+        draw_data->TotalIdxCount += entry.DrawList->IdxBuffer.Size;
+    }
+    draw_data->CmdListsCount = draw_data->CmdLists.Size;
+    return (int)packet_size;
+}
+
+#endif // #ifndef IMGUI_DISABLE
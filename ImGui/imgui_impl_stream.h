@@ -0,0 +1,74 @@
+// dear imgui: Draw data streaming (encoder + decoder)
+// ==================================================
+//
+// Serialize ImDrawData into a compact byte stream on one side (e.g. a headless
+// device running the UI), and rebuild an equivalent ImDrawData on the other side
+// (e.g. a viewer) which can be passed to any renderer backend supporting
+// ImGuiBackendFlags_RendererHasTextures. Transport is left to the application:
+// the encoder appends packets to a buffer, the decoder consumes packets from
+// a buffer (socket, pipe, file, or simply the same buffer in loopback).
+//
+// Implemented features
+// --------------------
+//  [X] Draw lists unchanged since previous frame are sent as a 32-bit hash.
+//  [X] Vertices are quantized (pos: 1/16 px, uv: 1/65536) and delta encoded as varints.
+//  [X] Indices are delta encoded as varints.
+//  [X] Textures (ImTextureData) are sent only on create/update/destroy requests. Pixels are zero-run encoded.
+//  [X] Key frames to (re)synchronize a decoder joining late or after an error.
+//  [ ] User callbacks (ImDrawCmd::UserCallback) are not transmitted.
+//  [ ] User textures (raw ImTextureID) are transmitted as-is and are unlikely to be meaningful to the viewer.
+//
+// Basic usage
+// -----------
+//   // Device side (instead of a renderer backend)
+//   ImGui_ImplStream_Init();
+//   ImGui_ImplStream_NewFrame(); ImGui::NewFrame(); [...] ImGui::Render();
+//   ImGui_ImplStream_EncodeDrawData(ImGui::GetDrawData(), &packet);  // send 'packet' then clear it
+//
+//   // Viewer side
+//   ImGui_ImplStream_Decoder* decoder = ImGui_ImplStream_CreateDecoder();
+//   int used = ImGui_ImplStream_DecodeFrame(decoder, data, data_size);   // >0: one packet decoded
+//   if (used > 0) ImGui_ImplXXXX_RenderDrawData(ImGui_ImplStream_GetDrawData(decoder));
+//   if (used < 0) ...;  // Ask encoder for ImGui_ImplStream_RequestKeyFrame()
+//
+// See example_stream_loopback.cpp for a headless encoder -> decoder round trip which checks the decoded draw data.
+//
+// ---------------------------------------------------------------------------
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Encoder statistics. Per-frame values are for the last call to ImGui_ImplStream_EncodeDrawData().
+struct ImGui_ImplStream_Stats
+{
+    int     FrameBytes;         // Size of last frame packet: this is the bandwidth used by the frame.
+    int     TextureBytes;       // Part of FrameBytes used by texture messages.
+    int     DrawListsSent;      // Draw lists sent with their contents.
+    int     DrawListsReused;    // Draw lists sent as a hash of a list already held by the decoder.
+    int     VtxCount;           // Vertices sent with contents.
+    int     IdxCount;           // Indices sent with contents.
+    int     RawBytes;           // Size the sent draw lists would take as raw ImDrawVert/ImDrawIdx/ImDrawCmd arrays.
+    int     TotalFrames;
+    ImU64   TotalBytes;
+};
+
+// Encoder: registers as the renderer backend (handles ImTextureData requests by forwarding them in the stream).
+IMGUI_IMPL_API bool     ImGui_ImplStream_Init();
+IMGUI_IMPL_API void     ImGui_ImplStream_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplStream_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplStream_EncodeDrawData(ImDrawData* draw_data, ImVector<unsigned char>* out_packet);  // Append one frame packet to out_packet.
+IMGUI_IMPL_API void     ImGui_ImplStream_RequestKeyFrame();                                                          // Next packet re-sends all textures and draw lists.
+IMGUI_IMPL_API const ImGui_ImplStream_Stats* ImGui_ImplStream_GetStats();
+
+// Decoder: doesn't require a Dear ImGui context.
+// Textures are listed in GetDrawData()->Textures and are created/updated/destroyed by the viewer renderer backend.
+// Before destroying a decoder, call ImGui_ImplStream_DecoderReleaseTextures() and render its draw data once so the backend can release them.
+struct ImGui_ImplStream_Decoder;
+IMGUI_IMPL_API ImGui_ImplStream_Decoder* ImGui_ImplStream_CreateDecoder();
+IMGUI_IMPL_API void     ImGui_ImplStream_DestroyDecoder(ImGui_ImplStream_Decoder* decoder);
+IMGUI_IMPL_API int      ImGui_ImplStream_DecodeFrame(ImGui_ImplStream_Decoder* decoder, const void* data, int data_size); // Return bytes used by one packet, 0 if more data is needed, -1 on error (decoder then waits for a key frame).
+IMGUI_IMPL_API ImDrawData* ImGui_ImplStream_GetDrawData(ImGui_ImplStream_Decoder* decoder);
+IMGUI_IMPL_API void     ImGui_ImplStream_DecoderReleaseTextures(ImGui_ImplStream_Decoder* decoder);
+
+#endif // #ifndef IMGUI_DISABLE
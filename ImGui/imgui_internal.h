@@ -63,6 +63,9 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
@@ -148,6 +151,7 @@ struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
 // ImGui
 struct ImGuiBoxSelectState;         // Box-selection state (currently used by multi-selection, could potentially be used by others)
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
+struct ImGuiComboFilterState;       // Storage for ComboFiltered()
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
@@ -156,6 +160,7 @@ struct ImGuiErrorRecoveryState;     // Storage of stack sizes for error handling
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
+struct ImGuiLabelSizeCache;         // Storage for CalcItemLabelSize() when using ImGuiWindowFlags_CacheLabelSizes
 struct ImGuiLastItemData;           // Status storage for last submitted items
 struct ImGuiLocEntry;               // A localization entry.
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
@@ -167,6 +172,7 @@ struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
+struct ImGuiPlotStreamCache;        // Cached segment geometry for PlotLinesStream()
 struct ImGuiPopupData;              // Storage for current popup stack
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
@@ -305,6 +311,33 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #define IM_MSVC_WARNING_SUPPRESS(XXXX)
 #endif
 
+// Atomic loads and stores, used by ImFontAtlas when shared between threads (see ImFontAtlas::LockFn): glyph lookups read without locking what other threads publish while holding the lock.
+// Only for naturally aligned values up to pointer size. Acquire/Release order other memory accesses around them, Relaxed only make the access itself atomic.
+#if defined(__GNUC__) || defined(__clang__)
+template<typename T> static inline T    ImAtomicLoadAcquire(const T* p)             { T v; __atomic_load(p, &v, __ATOMIC_ACQUIRE); return v; }
+template<typename T> static inline T    ImAtomicLoadRelaxed(const T* p)             { T v; __atomic_load(p, &v, __ATOMIC_RELAXED); return v; }
+template<typename T> static inline void ImAtomicStoreRelease(T* p, T v)             { __atomic_store(p, &v, __ATOMIC_RELEASE); }
+template<typename T> static inline void ImAtomicStoreRelaxed(T* p, T v)             { __atomic_store(p, &v, __ATOMIC_RELAXED); }
+#elif defined(_MSC_VER)
+// Same as MSVC's std::atomic<>: volatile accesses, plus a barrier which on x86/x64 only needs to prevent the compiler from reordering.
+#include <intrin.h>
+#if defined(_M_IX86) || defined(_M_X64)
+#define IM_ATOMIC_BARRIER()             _ReadWriteBarrier()
+#else
+#define IM_ATOMIC_BARRIER()             __dmb(0xB)  // DMB ISH
+#endif
+template<typename T> static inline T    ImAtomicLoadAcquire(const T* p)             { T v = *(const volatile T*)p; IM_ATOMIC_BARRIER(); return v; }
+template<typename T> static inline T    ImAtomicLoadRelaxed(const T* p)             { return *(const volatile T*)p; }
+template<typename T> static inline void ImAtomicStoreRelease(T* p, T v)             { IM_ATOMIC_BARRIER(); *(volatile T*)p = v; }
+template<typename T> static inline void ImAtomicStoreRelaxed(T* p, T v)             { *(volatile T*)p = v; }
+#else
+// Plain accesses: implement them yourself (e.g. with std::atomic_ref<> or your compiler's intrinsics) before sharing a ImFontAtlas between threads with another compiler!
+template<typename T> static inline T    ImAtomicLoadAcquire(const T* p)             { return *p; }
+template<typename T> static inline T    ImAtomicLoadRelaxed(const T* p)             { return *p; }
+template<typename T> static inline void ImAtomicStoreRelease(T* p, T v)             { *p = v; }
+template<typename T> static inline void ImAtomicStoreRelaxed(T* p, T v)             { *p = v; }
+#endif
+
 // Debug Tools
 // Use 'Metrics/Debugger->Tools->Item Picker' to break into the call-stack of a specific item.
 // This will call IM_DEBUG_BREAK() which you may redefine yourself. See https://github.com/scottt/debugbreak for more reference.
@@ -830,6 +863,20 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Number of polyline segments sharing one bounding box test when culling (ImDrawListFlags_CullOffscreen).
+#ifndef IM_DRAWLIST_CULL_CHUNK_SEGMENTS
+#define IM_DRAWLIST_CULL_CHUNK_SEGMENTS                         64
+#endif
+
+// Point of a cached anti-aliased fill template for circles and rounded rectangles (see ImDrawList::_FillShapeTemplate())
+// Position is 'centers[Corner] + Dir * radii[Corner]', AA fringe is offset by +/- 'Normal * fringe_scale * 0.5f'.
+struct ImDrawListShapePoint
+{
+    ImVec2          Dir;                        // Sample from ArcFastVtx[], or (0,0) for a non-rounded corner
+    ImVec2          Normal;                     // Averaged edge normal (already fixed up with IM_FIXNORMAL2F)
+    int             Corner;                     // 0..3 = top-left, top-right, bottom-right, bottom-left. Always 0 for circles.
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -850,12 +897,19 @@ struct IMGUI_API ImDrawListSharedData
     ImVector<ImVec2> TempBuffer;                // Temporary write buffer
     ImVector<ImDrawList*> DrawLists;            // All draw lists associated to this ImDrawListSharedData
     ImGuiContext*   Context;                    // [OPTIONAL] Link to Dear ImGui context. 99% of ImDrawList/ImFontAtlas can function without an ImGui context, but this facilitate handling one legacy edge case.
+    ImTextureRef    FontAtlasTexRef;            // Copy of FontAtlas->TexRef, when FontAtlas is shared between threads. Use ImFontAtlasGetTexRef().
+    ImVec4          TexUvLinesCopy[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1]; // Copy of FontAtlas->TexUvLines[], pointed to by TexUvLines when FontAtlas is shared between threads.
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
 
+    // Anti-aliased fill templates, indexed by [arc step * 16 + rounded corners mask] (mask == 0 for circles).
+    // Normals only depend on the arc step and on which corners are rounded, so they are computed once and shapes are emitted by scaled copy.
+    ImVector<ImDrawListShapePoint> ShapeTemplatePoints;
+    ImVec2ih        ShapeTemplates[(IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4 + 1) * 16];  // Offset and count in ShapeTemplatePoints[]. Count == 0 when not built yet.
+
     ImDrawListSharedData();
     ~ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
@@ -1146,6 +1200,50 @@ struct IMGUI_API ImGuiComboPreviewData
     ImGuiComboPreviewData() { memset(this, 0, sizeof(*this)); }
 };
 
+// Storage for CalcItemLabelSize() when using ImGuiWindowFlags_CacheLabelSizes.
+// Items are generally submitted in the same order every frame: sizes are recorded in submission order and read back with a cursor on next frame.
+// An item ID computed from its label (e.g. window->GetID(label)) already hashes the label text, so a changed label is a different entry.
+struct ImGuiLabelSizeCacheEntry
+{
+    ImGuiID         ID;
+    float           FontSize;
+    ImFontBaked*    FontBaked;
+    ImVec2          Size;
+};
+
+struct IMGUI_API ImGuiLabelSizeCache
+{
+    ImVector<ImGuiLabelSizeCacheEntry> Entries;     // Written this frame
+    ImVector<ImGuiLabelSizeCacheEntry> EntriesPrev; // Written last frame, read with ReadCursor
+    int             ReadCursor;
+    int             Generation;         // == g.LabelSizeCacheGeneration when entries are valid
+    int             Hits, Misses;       // Stats for current frame
+    int             HitsPrev, MissesPrev;
+
+    ImGuiLabelSizeCache()               { ReadCursor = Generation = Hits = Misses = HitsPrev = MissesPrev = 0; }
+    void NewFrame()                     { Entries.swap(EntriesPrev); Entries.resize(0); ReadCursor = 0; HitsPrev = Hits; MissesPrev = Misses; Hits = Misses = 0; }
+    void ClearFreeMemory()              { Entries.clear(); EntriesPrev.clear(); ReadCursor = Hits = Misses = HitsPrev = MissesPrev = 0; }
+};
+
+// Storage for ComboFiltered(): items text + trigram index of the last opened combo, reused as long as ID/DataVersion/ItemsCount match.
+#define IMGUI_COMBO_FILTER_BUCKETS_BITS     12
+struct IMGUI_API ImGuiComboFilterState
+{
+    ImGuiID         ID;                 // Combo the index was built for
+    int             DataVersion;
+    int             ItemsCount;         // -1 when index isn't built
+    ImVector<char>  TextUpper;          // Items text with ASCII upper-cased (as ImStristr()), zero-terminated, one after another
+    ImVector<int>   TextOffsets;        // Item index -> offset in TextUpper
+    ImVector<int>   BucketStarts;       // Trigram bucket -> offset in BucketItems (one extra entry at the end)
+    ImVector<int>   BucketItems;        // Per bucket: sorted indices of items containing a trigram of this bucket
+    ImVector<int>   Results;            // Indices of items passing the filter
+    char            Filter[256];        // Filter edited by user
+    char            FilterApplied[256]; // Filter used to compute Results
+
+    ImGuiComboFilterState()             { ID = 0; DataVersion = 0; ItemsCount = -1; Filter[0] = FilterApplied[0] = 0; }
+    void ClearFreeMemory()              { ItemsCount = -1; TextUpper.clear(); TextOffsets.clear(); BucketStarts.clear(); BucketItems.clear(); Results.clear(); }
+};
+
 // Stacked storage data for BeginGroup()/EndGroup()
 struct IMGUI_API ImGuiGroupData
 {
@@ -1216,6 +1314,7 @@ struct IMGUI_API ImGuiInputTextState
     ImVector<char>          TextA;                  // main UTF8 buffer. TextA.Size is a buffer size! Should always be >= buf_size passed by user (and of course >= CurLenA + 1).
     ImVector<char>          TextToRevertTo;         // value to revert to when pressing Escape = backup of end-user buffer at the time of focus (in UTF-8, unaltered)
     ImVector<char>          CallbackTextBackup;     // temporary storage for callback to support automatic reconcile of undo-stack
+    ImVector<int>           LineStarts;             // multi-line: byte offset of the first lines, built lazily when locating rows and truncated on edits. Empty when invalidated.
     int                     BufCapacity;            // end-user buffer capacity (include zero terminator)
     ImVec2                  Scroll;                 // horizontal offset (managed manually) + vertical scrolling (pulled from child window's own Scroll.y)
     float                   CursorAnim;             // timer for cursor blink, reset on every user action so the cursor reappears immediately
@@ -1228,8 +1327,8 @@ struct IMGUI_API ImGuiInputTextState
 
     ImGuiInputTextState();
     ~ImGuiInputTextState();
-    void        ClearText()                 { TextLen = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); }
+    void        ClearText()                 { TextLen = 0; TextA[0] = 0; LineStarts.resize(0); CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); TextToRevertTo.clear(); LineStarts.clear(); }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
     void        OnCharPressed(unsigned int c);
 
@@ -1259,6 +1358,7 @@ enum ImGuiWindowRefreshFlags_
     ImGuiWindowRefreshFlags_TryToAvoidRefresh   = 1 << 0,   // [EXPERIMENTAL] Try to keep existing contents, USER MUST NOT HONOR BEGIN() RETURNING FALSE AND NOT APPEND.
     ImGuiWindowRefreshFlags_RefreshOnHover      = 1 << 1,   // [EXPERIMENTAL] Always refresh on hover
     ImGuiWindowRefreshFlags_RefreshOnFocus      = 1 << 2,   // [EXPERIMENTAL] Always refresh on focus
+    ImGuiWindowRefreshFlags_RefreshOnInput      = 1 << 3,   // [EXPERIMENTAL] Refresh when owning the active item, when focused and receiving keyboard inputs, when a popup opened from it is open, and when gaining/losing focus
     // Refresh policy/frequency, Load Balancing etc.
 };
 
@@ -1301,6 +1401,7 @@ struct ImGuiNextWindowData
     float                       BgAlphaVal;             // Override background alpha
     ImVec2                      MenuBarOffsetMinVal;    // (Always on) This is not exposed publicly, so we don't clear it and it doesn't have a corresponding flag (could we? for consistency?)
     ImGuiWindowRefreshFlags     RefreshFlagsVal;
+    float                       RefreshRateVal;         // With ImGuiWindowRefreshFlags_TryToAvoidRefresh: refresh at this rate in Hz (0.0f: only as requested by other flags)
 
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
     inline void ClearFlags()    { HasFlags = ImGuiNextWindowDataFlags_None; }
@@ -1420,6 +1521,32 @@ struct ImGuiDeactivatedItemData
     bool        IsAlive;
 };
 
+// Cached segment geometry for PlotLinesStream(), stored in ImGuiPlotStream::TempData
+// - Segment starting at sample Values[n] is stored at SegVtx[n * VtxPerSegment], so segments are recycled along with samples.
+// - Positions are relative to the top of the plot, and to an horizontal origin where the newest sample is at NewestX.
+struct ImGuiPlotStreamCache
+{
+    ImDrawList*             TessDrawList;       // Scratch draw list used to tessellate new segments
+    ImVector<ImDrawVert>    SegVtx;             // Vertices of all segments, VtxPerSegment per segment
+    ImVector<ImDrawIdx>     SegIdx;             // Indices of one segment, relative to its first vertex
+    int                     VtxPerSegment;
+    float                   NewestX;            // Horizontal position of the newest sample in SegVtx[]
+    bool                    NeedRebuild;
+
+    // Parameters used for tessellation. Geometry is rebuilt when one of them changes.
+    ImVec2                  Size;
+    float                   ScaleMin;
+    float                   ScaleMax;
+    ImU32                   Col;
+    ImDrawListFlags         Flags;
+    float                   FringeScale;
+    ImVec2                  TexUvWhitePixel;
+    ImVec4                  TexUvLines;
+
+    ImGuiPlotStreamCache()  { memset((void*)this, 0, sizeof(*this)); NeedRebuild = true; }
+    ~ImGuiPlotStreamCache() { if (TessDrawList) IM_DELETE(TessDrawList); }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Popup support
 //-----------------------------------------------------------------------------
@@ -2071,6 +2198,22 @@ struct ImGuiDebugAllocInfo
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Statistics for compaction of transient window buffers (see io.ConfigMemoryCompactTimer, io.ConfigMemoryCompactBudget)
+struct ImGuiGcStats
+{
+    ImU64       CompactedBytes;             // Total bytes freed by fully compacting inactive windows.
+    ImU64       TrimmedBytes;               // Total bytes freed by trimming buffers capacity toward recent high-water marks.
+    ImU64       RegrowthBytes;              // Total bytes allocated again by windows growing back after being compacted or trimmed.
+    ImU64       RetainedBytes;              // Bytes held by draw list buffers of inactive, non-compacted windows (updated every frame).
+    int         CompactCount;
+    int         TrimCount;
+    int         AwakeCount;
+    int         DeferredCount;              // Number of windows which still wanted compaction when the per-frame limit was reached, last frame.
+    int         LastFrameProcessedBytes;    // Bytes freed or moved by compaction during last frame.
+
+    ImGuiGcStats() { memset(this, 0, sizeof(*this)); }
+};
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2145,6 +2288,7 @@ struct ImGuiContext
     ImVector<ImFontAtlas*>  FontAtlases;                        // List of font atlases used by the context (generally only contains g.IO.Fonts aka the main font atlas)
     ImFont*                 Font;                               // Currently bound font. (== FontStack.back().Font)
     ImFontBaked*            FontBaked;                          // Currently bound font at currently bound size. (== Font->GetFontBaked(FontSize))
+    int                     LabelSizeCacheGeneration;           // Incremented when baked fonts are discarded, invalidating ImGuiWindow::LabelSizeCache.
     float                   FontSize;                           // Currently bound font size == line height (== FontSizeBase + externals scales applied in the UpdateCurrentFontSize() function).
     float                   FontSizeBase;                       // Font size before scaling == style.FontSizeBase == value passed to PushFont() when specified.
     float                   FontBakedScale;                     // == FontBaked->Size / FontSize. Scale factor over baked size. Rarely used nowadays, very often == 1.0f.
@@ -2159,6 +2303,8 @@ struct ImGuiContext
     bool                    WithinFrameScope;                   // Set by NewFrame(), cleared by EndFrame()
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    GcCompactAll;                       // Request full GC
+    int                     GcWindowsCursor;                    // Index in Windows[] where incremental compaction resumes on next frame
+    ImGuiGcStats            GcStats;
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
     char                    ContextName[16];                    // Storage for a context name (to facilitate debugging multi-context setups)
@@ -2173,6 +2319,7 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImVector<ImRect>        WindowsOccluderRects;               // Temporary buffer used in Render() to accumulate opaque areas of windows above the one being tested (io.ConfigWindowsOcclusionCulling)
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -2400,6 +2547,10 @@ struct ImGuiContext
     ImGuiInputTextDeactivatedState InputTextDeactivatedState;
     ImFontBaked             InputTextPasswordFontBackupBaked;
     ImFontFlags             InputTextPasswordFontBackupFlags;
+    ImFont                  InputTextPasswordFont;              // Shared font atlas: context-local font holding only the '*' glyph, so PushPasswordFont() doesn't modify fonts used by other contexts.
+    ImFontBaked             InputTextPasswordFontBaked;
+    ImFont*                 InputTextPasswordFontBackupFont;
+    ImFontBaked*            InputTextPasswordFontBackupFontBaked;
     ImGuiID                 TempInputId;                        // Temporary text input when CTRL+clicking on a slider, etc.
     ImGuiDataTypeStorage    DataTypeZeroValue;                  // 0 for all data types
     int                     BeginMenuDepth;
@@ -2412,6 +2563,7 @@ struct ImGuiContext
     ImU32                   ColorEditSavedColor;                // RGB value with alpha set to 0.
     ImVec4                  ColorPickerRef;                     // Initial/reference color at the time of opening the color picker.
     ImGuiComboPreviewData   ComboPreviewData;
+    ImGuiComboFilterState   ComboFilterState;
     ImRect                  WindowResizeBorderExpectedRect;     // Expected border rect, switch to relative edit if moving
     bool                    WindowResizeRelativeMode;
     short                   ScrollbarSeekMode;                  // 0: scroll to clicked location, -1/+1: prev/next page.
@@ -2615,8 +2767,12 @@ struct IMGUI_API ImGuiWindow
     bool                    WantCollapseToggle;
     bool                    SkipItems;                          // Set when items can safely be all clipped (e.g. window not visible or collapsed)
     bool                    SkipRefresh;                        // [EXPERIMENTAL] Reuse previous frame drawn contents, Begin() returns false.
+    bool                    RefreshAfterInput;                  // [EXPERIMENTAL] Last refresh was caused by an interaction: refresh once more to display the state following it (e.g. item not hovered anymore).
+    bool                    RefreshFocused;                     // [EXPERIMENTAL] Was focused on last refresh.
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
+    bool                    RenderOccluded;                     // Set by last Render() when all geometry was covered by opaque windows above it (io.ConfigWindowsOcclusionCulling). Root windows only.
+    bool                    SkipItemsOccluded;                  // Set when SkipItems is only set because the window was occluded (io.ConfigWindowsOcclusionSkipItems). Contents sizes are preserved.
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
     bool                    IsExplicitChild;                    // Set when passed _ChildWindow, left to false by BeginDocked()
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
@@ -2651,12 +2807,17 @@ struct IMGUI_API ImGuiWindow
     ImRect                  WorkRect;                           // Initially covers the whole scrolling region. Reduced by containers e.g columns/tables when active. Shrunk by WindowPadding*1.0f on each side. This is meant to replace ContentRegionRect over time (from 1.71+ onward).
     ImRect                  ParentWorkRect;                     // Backup of WorkRect before entering a container such as columns/tables. Used by e.g. SpanAllColumns functions to easily access. Stacked containers are responsible for maintaining this. // FIXME-WORKRECT: Could be a stack?
     ImRect                  ClipRect;                           // Current clipping/scissoring rectangle, evolve as we are using PushClipRect(), etc. == DrawList->clip_rect_stack.back().
+    ImRect                  OpaqueRect;                         // Area fully covered by opaque window background (+ title bar) during last RenderWindowDecorations(). Empty if not opaque. Used for occlusion culling.
     ImRect                  ContentRegionRect;                  // FIXME: This is currently confusing/misleading. It is essentially WorkRect but not handling of scrolling. We currently rely on it as right/bottom aligned sizing operation need some size to rely on.
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
+    double                  RefreshLastTime;                    // [EXPERIMENTAL] Last timestamp contents were submitted (not skipped with SkipRefresh).
+    ImVec2                  RefreshPos;                         // [EXPERIMENTAL] Pos on last refresh. Skipped frames display contents at this position.
+    ImVec2                  RefreshSizeFull;                    // [EXPERIMENTAL] SizeFull on last refresh.
+    int                     RefreshTexUniqueID;                 // [EXPERIMENTAL] Font atlas texture on last refresh. Contents reference it, so a new texture requires a refresh.
     float                   ItemWidthDefault;
     ImGuiStorage            StateStorage;
     ImVector<ImGuiOldColumns> ColumnsStorage;
@@ -2683,7 +2844,14 @@ struct IMGUI_API ImGuiWindow
 
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+    int                     MemoryDrawListIdxHighWater;         // Largest idx/vtx count since last trim. Buffers capacity are trimmed toward this rather than freed.
+    int                     MemoryDrawListVtxHighWater;
+    int                     MemoryDrawListIdxTrimmedCapacity;   // Capacity after last trim/awake (0 if none), to measure re-growth cost
+    int                     MemoryDrawListVtxTrimmedCapacity;
+    float                   MemoryLastTrimTime;                 // Last time buffers were trimmed (or considered for trimming)
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
+    bool                    MemoryTrimmed;                      // Set when buffers of an inactive window have been trimmed. Cleared when the window becomes active.
+    ImGuiLabelSizeCache     LabelSizeCache;                     // Label sizes of last frame, when using ImGuiWindowFlags_CacheLabelSizes
 
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
@@ -3020,6 +3188,7 @@ struct IMGUI_API ImGuiTableTempData
     float                       LastTimeActive;             // Last timestamp this structure was used
     float                       AngledHeadersExtraWidth;    // Used in EndTable()
     ImVector<ImGuiTableHeaderData> AngledHeadersRequests;   // Used in TableAngledHeadersRow()
+    ImVector<float>             TextRowsPosY1;              // Used in TableTextRows()
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
@@ -3219,6 +3388,7 @@ namespace ImGui
     IMGUI_API bool          IsClippedEx(const ImRect& bb, ImGuiID id);
     IMGUI_API void          SetLastItemData(ImGuiID item_id, ImGuiItemFlags item_flags, ImGuiItemStatusFlags status_flags, const ImRect& item_rect);
     IMGUI_API ImVec2        CalcItemSize(ImVec2 size, float default_w, float default_h);
+    IMGUI_API ImVec2        CalcItemLabelSize(ImGuiID id, const char* label);   // == CalcTextSize(label, NULL, true), cached with ImGuiWindowFlags_CacheLabelSizes. 'id' must be computed from 'label'.
     IMGUI_API float         CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x);
     IMGUI_API void          PushMultiItemsWidths(int components, float width_full);
     IMGUI_API void          ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_excess);
@@ -3617,6 +3787,7 @@ namespace ImGui
     // Garbage collection
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API int           GcTrimTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
 
     // Error handling, State Recovery
@@ -3806,6 +3977,47 @@ struct ImFontAtlasBuilder
     ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
 };
 
+// Per-context copy of a texture of a ImFontAtlas shared across threads (see ImFontAtlas::LockFn).
+// The copy points to the pixels of the atlas texture, but has its own Status/Updates/TexID for the renderer backend of its context.
+struct ImFontAtlasSharedTexture
+{
+    ImTextureData*              Source;                 // Atlas texture. Not listed in GetPlatformIO().Textures[] when atlas is shared.
+    ImTextureData*              Copy;                   // Listed in GetPlatformIO().Textures[] of the context.
+    ImVector<ImTextureRect>     PendingUpdates;         // Updates of Source not yet queued on Copy. Written by any thread while holding the lock.
+};
+
+// Per-context state of a ImFontAtlas shared across threads
+struct ImFontAtlasSharedUser
+{
+    ImDrawListSharedData*       DrawListSharedData;     // Identify the context
+    int                         Epoch;                  // Value of ImFontAtlasSharedData::Epoch when context started its current frame
+    int                         BakedDiscardCount;      // Value of ImFontAtlasSharedData::BakedDiscardCount when context started its current frame
+    ImVector<ImFontAtlasSharedTexture> Textures;
+
+    ImFontAtlasSharedUser()     { DrawListSharedData = NULL; Epoch = BakedDiscardCount = 0; }
+};
+
+// Data released by the atlas while other contexts may still be reading it during their current frame. One of Alloc/Tex/Baked is set.
+struct ImFontAtlasSharedRetired
+{
+    int                         Epoch;                  // Can be freed once every user's Epoch is >= this
+    void*                       Alloc;                  // Freed with IM_FREE()
+    ImTextureData*              Tex;                    // Deleted
+    ImFontBaked*                Baked;                  // Released (glyphs, loader data, packed rectangles) then reused by ImFontAtlasBakedAdd()
+};
+
+// Storage for a ImFontAtlas shared across threads. Only accessed while holding the lock.
+struct ImFontAtlasSharedData
+{
+    int                         Epoch;                  // Incremented when retiring data
+    int                         BakedDiscardCount;      // Incremented when discarding a baked size, so contexts can invalidate caches keyed on ImFontBaked*
+    ImVector<ImFontAtlasSharedUser*> Users;
+    ImVector<ImFontAtlasSharedRetired> Retired;
+    ImVector<ImFontBaked*>      BakedFreeList;          // Released bakes. BakedPool[] is never compacted while shared, as other threads may hold pointers into it.
+
+    ImFontAtlasSharedData()     { Epoch = BakedDiscardCount = 0; }
+};
+
 IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildDestroy(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildMain(ImFontAtlas* atlas);
@@ -3854,6 +4066,17 @@ IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas,
 IMGUI_API void              ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
 IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex);
 IMGUI_API void              ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas);
+IMGUI_API ImTextureRef      ImFontAtlasGetTexRef(ImFontAtlas* atlas, ImDrawListSharedData* data);
+
+inline void                 ImFontAtlasSharedLock(ImFontAtlas* atlas)   { if (atlas->LockFn) atlas->LockFn(atlas->LockUserData); }
+inline void                 ImFontAtlasSharedUnlock(ImFontAtlas* atlas) { if (atlas->UnlockFn) atlas->UnlockFn(atlas->LockUserData); }
+IMGUI_API void              ImFontAtlasSharedCreate(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasSharedRetire(ImFontAtlas* atlas, void* alloc, ImTextureData* tex, ImFontBaked* baked);
+IMGUI_API void              ImFontAtlasSharedReclaim(ImFontAtlas* atlas, bool force);
+IMGUI_API void              ImFontAtlasSharedNewFrame(ImFontAtlas* atlas, ImDrawListSharedData* data);
+IMGUI_API void              ImFontAtlasSharedEndFrame(ImFontAtlas* atlas, ImDrawListSharedData* data, ImVector<ImTextureData*>* out_textures);
+IMGUI_API void              ImFontAtlasSharedUpdateDrawDataTextures(ImFontAtlas* atlas, ImDrawListSharedData* data, ImDrawData* draw_data);
+IMGUI_API void              ImFontAtlasSharedRemoveUser(ImFontAtlas* atlas, ImDrawListSharedData* data);
 
 IMGUI_API void              ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data);
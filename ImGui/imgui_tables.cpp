@@ -1869,6 +1869,7 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
 // - TableNextRow()
 // - TableBeginRow() [Internal]
 // - TableEndRow() [Internal]
+// - TableTextRows()
 //-------------------------------------------------------------------------
 
 // [Public] Note: for row coloring we use ->RowBgColorCounter which is the same value without counting header rows
@@ -2090,6 +2091,204 @@ void ImGui::TableEndRow(ImGuiTable* table)
     table->IsInsideRow = false;
 }
 
+// [Internal] Submit one text cell for TableTextRows(). Returns the width CalcTextSize() would report.
+// This is the same as TextUnformatted() -> ItemSize() + ItemAdd() + ImFont::RenderText(), minus the per-item overhead.
+// Only the first line is used. Glyphs are emitted while measuring, and given back if the item turns out to be clipped.
+static float TableTextRowsCell(ImDrawList* draw_list, ImFont* font, float size, const ImVec2& pos, ImU32 col, const ImRect& item_clip_rect, const char* text)
+{
+    const char* text_end = text + ImStrlen(text);
+    if (const char* line_end = (const char*)ImMemchr(text, '\n', text_end - text))
+        text_end = line_end;
+
+begin:
+    ImFontBaked* baked = font->GetFontBaked(size);
+    const float scale = size / baked->Size;
+    const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+    const float origin_x = IM_TRUNC(pos.x);
+    const float y = IM_TRUNC(pos.y);
+
+    // Vertical clipping is known ahead (ItemAdd() test, then RenderText() line test). Horizontal clipping requires the width.
+    const bool render = (col & IM_COL32_A_MASK) != 0 && text != text_end
+        && pos.y < item_clip_rect.Max.y && pos.y + size > item_clip_rect.Min.y && y <= clip_rect.w && y + size >= clip_rect.y;
+    const int vtx_count_max = render ? (int)(text_end - text) * 4 : 0;
+    const int idx_count_max = render ? (int)(text_end - text) * 6 : 0;
+    if (render)
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    const int idx_expected_size = draw_list->IdxBuffer.Size;
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    const int cmd_count = draw_list->CmdBuffer.Size;
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+
+    float x = origin_x;
+    float line_width = 0.0f;
+    for (const char* s = text; s < text_end; )
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c == '\r')
+            continue;
+
+        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+        const float char_width = glyph->AdvanceX * scale;
+        if (render && glyph->Visible)
+        {
+            const float x1 = x + glyph->X0 * scale;
+            const float x2 = x + glyph->X1 * scale;
+            if (x1 <= clip_rect.z && x2 >= clip_rect.x)
+            {
+                const float y1 = y + glyph->Y0 * scale;
+                const float y2 = y + glyph->Y1 * scale;
+                const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+                vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv = ImVec2(glyph->U0, glyph->V0);
+                vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv = ImVec2(glyph->U1, glyph->V0);
+                vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv = ImVec2(glyph->U1, glyph->V1);
+                vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv = ImVec2(glyph->U0, glyph->V1);
+                idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+                idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+                vtx_write += 4;
+                vtx_index += 4;
+                idx_write += 6;
+            }
+        }
+        x += char_width;
+        line_width += char_width;
+    }
+    const float width = IM_TRUNC(line_width + 0.99999f); // Same rounding as CalcTextSize()
+    if (!render)
+        return width;
+
+    // Loading glyphs triggered a texture change: retry (see ImFont::RenderText())
+    if (cmd_count != draw_list->CmdBuffer.Size)
+    {
+        IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
+        draw_list->CmdBuffer.pop_back();
+        draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
+        draw_list->AddDrawCmd();
+        goto begin;
+    }
+
+    // Horizontally clipped item: give back everything
+    if (!(pos.x < item_clip_rect.Max.x && pos.x + width > item_clip_rect.Min.x))
+    {
+        vtx_write = draw_list->_VtxWritePtr;
+        idx_write = draw_list->_IdxWritePtr;
+        vtx_index = draw_list->_VtxCurrentIdx;
+    }
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+    return width;
+}
+
+static const char* TableTextRowsColumnsGetter(void* data, int row_n, int column_n)
+{
+    const char* const* const* columns_values = (const char* const* const*)data;
+    return columns_values[column_n][row_n];
+}
+
+// [Public] Submit rows [row_start,row_end) of single-line text cells. Output and layout are the same as calling
+// TableNextRow() + TableNextColumn() + TextUnformatted() for every cell, but much cheaper on large grids:
+// - A first pass calls TableNextRow() for each row, so row backgrounds, borders, hovering and the list clipper are unaffected.
+//   Row heights are known upfront since all cells are a single line of text.
+// - A second pass goes column by column, selects the column draw channel once and writes glyphs directly into it.
+//   Clipped columns are not queried nor measured.
+// Frozen rows and logging take the regular path. Text after a '\n' is not displayed. Leaves the table like TableNextRow() would.
+void ImGui::TableTextRows(const char* (*values_getter)(void* data, int row_n, int column_n), void* data, int row_start, int row_end)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableTextRows() after BeginTable()!");
+    if (row_start >= row_end)
+        return;
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(table);
+
+    ImGuiWindow* window = table->InnerWindow;
+    ImGuiTableTempData* temp_data = table->TempData;
+    const int columns_count = table->ColumnsCount;
+    bool has_visible_column = false;
+    for (int column_n = 0; column_n < columns_count && !has_visible_column; column_n++)
+        has_visible_column = !table->Columns[column_n].IsSkipItems;
+
+    // Rows
+    const float item_spacing_y = g.Style.ItemSpacing.y;
+    int bulk_row_start = row_end;
+    temp_data->TextRowsPosY1.resize(0);
+    for (int row_n = row_start; row_n < row_end; row_n++)
+    {
+        TableNextRow();
+        if (table->CurrentRow < table->FreezeRowsCount || g.LogEnabled)
+        {
+            for (int column_n = 0; column_n < columns_count; column_n++)
+            {
+                TableSetColumnIndex(column_n);
+                const char* text = values_getter(data, row_n, column_n);
+                TextUnformatted(text ? text : "");
+            }
+            continue;
+        }
+        if (temp_data->TextRowsPosY1.Size == 0)
+            bulk_row_start = row_n;
+        temp_data->TextRowsPosY1.push_back(table->RowPosY1);
+
+        // Same as TableEndCell() after a TextUnformatted() call (see ItemSize())
+        if (has_visible_column)
+            table->RowPosY2 = ImMax(table->RowPosY2, IM_TRUNC(table->RowPosY1 + table->RowCellPaddingY + g.FontSize + item_spacing_y) - item_spacing_y + table->RowCellPaddingY);
+    }
+    const int rows_count = temp_data->TextRowsPosY1.Size;
+    if (rows_count == 0)
+        return;
+
+    // Columns
+    ImDrawList* draw_list = window->DrawList;
+    const ImU32 col = GetColorU32(ImGuiCol_Text);
+    for (int column_n = 0; column_n < columns_count; column_n++)
+    {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        float start_x = column->WorkMinX;
+        if (column->Flags & ImGuiTableColumnFlags_IndentEnable)
+            start_x += table->RowIndentOffsetX;
+
+        float max_pos_x = start_x;
+        if (!column->IsSkipItems)
+        {
+            if (table->Flags & ImGuiTableFlags_NoClip)
+            {
+                table->DrawSplitter->SetCurrentChannel(draw_list, TABLE_DRAW_CHANNEL_NOCLIP);
+            }
+            else
+            {
+                SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
+                table->DrawSplitter->SetCurrentChannel(draw_list, column->DrawChannelCurrent);
+            }
+            for (int n = 0; n < rows_count; n++)
+            {
+                const char* text = values_getter(data, bulk_row_start + n, column_n);
+                const ImVec2 text_pos(start_x, temp_data->TextRowsPosY1[n] + table->RowCellPaddingY);
+                const float text_width = TableTextRowsCell(draw_list, g.Font, g.FontSize, text_pos, col, window->ClipRect, text ? text : "");
+                max_pos_x = ImMax(max_pos_x, start_x + text_width);
+            }
+        }
+
+        // Same as TableEndCell()
+        float* p_max_pos_x = table->IsUnfrozenRows ? &column->ContentMaxXUnfrozen : &column->ContentMaxXFrozen;
+        *p_max_pos_x = ImMax(*p_max_pos_x, max_pos_x);
+    }
+}
+
+void ImGui::TableTextRows(const char* const* const* columns_values, int row_start, int row_end)
+{
+    TableTextRows(&TableTextRowsColumnsGetter, (void*)columns_values, row_start, row_end);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Columns changes
 //-------------------------------------------------------------------------
@@ -773,7 +773,7 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
 
     ImVec2 pos = window->DC.CursorPos;
     if ((flags & ImGuiButtonFlags_AlignTextBaseLine) && style.FramePadding.y < window->DC.CurrLineTextBaseOffset) // Try to vertically align buttons that are smaller/have no padding so that text baseline matches (bit hacky, since it shouldn't be a flag)
@@ -1217,7 +1217,7 @@ bool ImGui::Checkbox(const char* label, bool* v)
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
 
     const float square_sz = GetFrameHeight();
     const ImVec2 pos = window->DC.CursorPos;
@@ -1339,7 +1339,7 @@ bool ImGui::RadioButton(const char* label, bool active)
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
 
     const float square_sz = GetFrameHeight();
     const ImVec2 pos = window->DC.CursorPos;
@@ -1881,6 +1881,7 @@ void ImGui::ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_exc
 // - BeginComboPreview() [Internal]
 // - EndComboPreview() [Internal]
 // - Combo()
+// - ComboFiltered()
 //-------------------------------------------------------------------------
 
 static float CalcMaxPopupHeightFromItemCount(int items_count)
@@ -1908,7 +1909,7 @@ bool ImGui::BeginCombo(const char* label, const char* preview_value, ImGuiComboF
         IM_ASSERT((flags & (ImGuiComboFlags_NoPreview | (ImGuiComboFlags)ImGuiComboFlags_CustomPreview)) == 0);
 
     const float arrow_size = (flags & ImGuiComboFlags_NoArrowButton) ? 0.0f : GetFrameHeight();
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
     const float preview_width = ((flags & ImGuiComboFlags_WidthFitPreview) && (preview_value != NULL)) ? CalcTextSize(preview_value, NULL, true).x : 0.0f;
     const float w = (flags & ImGuiComboFlags_NoPreview) ? arrow_size : ((flags & ImGuiComboFlags_WidthFitPreview) ? (arrow_size + preview_width + style.FramePadding.x * 2.0f) : CalcItemWidth());
     const ImRect bb(window->DC.CursorPos, window->DC.CursorPos + ImVec2(w, label_size.y + style.FramePadding.y * 2.0f));
@@ -2165,6 +2166,195 @@ bool ImGui::Combo(const char* label, int* current_item, const char* (*getter)(vo
     return value_changed;
 }
 
+// Trigram index for ComboFiltered(): a filter of 3+ characters only needs to test items sharing its rarest trigram bucket.
+static inline int ComboFilterTrigramBucket(const char* p)
+{
+    const ImU32 trigram = ((ImU32)(unsigned char)p[0] << 16) | ((ImU32)(unsigned char)p[1] << 8) | (ImU32)(unsigned char)p[2];
+    return (int)((trigram * 2654435761u) >> (32 - IMGUI_COMBO_FILTER_BUCKETS_BITS));
+}
+
+static void ComboFilterBuildIndex(ImGuiComboFilterState* fs, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count)
+{
+    // Copy items text, upper-cased the same way as ImStristr() does
+    fs->TextUpper.resize(0);
+    fs->TextOffsets.resize(items_count);
+    for (int item_n = 0; item_n < items_count; item_n++)
+    {
+        const char* item_text = getter(user_data, item_n);
+        if (item_text == NULL)
+            item_text = "";
+        const int item_len = (int)ImStrlen(item_text);
+        fs->TextOffsets[item_n] = fs->TextUpper.Size;
+        fs->TextUpper.resize(fs->TextUpper.Size + item_len + 1);
+        char* dst = fs->TextUpper.Data + fs->TextOffsets[item_n];
+        for (int n = 0; n < item_len; n++)
+            dst[n] = ImToUpper(item_text[n]);
+        dst[item_len] = 0;
+    }
+
+    // Two passes: count entries per bucket, then fill. Items are visited in order so a given bucket's items stay sorted,
+    // and an item having several trigrams in the same bucket is only added once (by checking last added entry).
+    const int buckets_count = 1 << IMGUI_COMBO_FILTER_BUCKETS_BITS;
+    fs->BucketStarts.resize(buckets_count + 1);
+    memset(fs->BucketStarts.Data, 0, (size_t)fs->BucketStarts.size_in_bytes());
+    ImVector<int> last_item;
+    ImVector<int> write_offsets;
+    last_item.resize(buckets_count, -1);
+    for (int pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+        {
+            for (int bucket_n = 0, offset = 0; bucket_n <= buckets_count; bucket_n++)
+            {
+                const int count = fs->BucketStarts[bucket_n];
+                fs->BucketStarts[bucket_n] = offset;
+                offset += count;
+            }
+            fs->BucketItems.resize(fs->BucketStarts[buckets_count]);
+            write_offsets = fs->BucketStarts;
+            for (int bucket_n = 0; bucket_n < buckets_count; bucket_n++)
+                last_item[bucket_n] = -1;
+        }
+        for (int item_n = 0; item_n < items_count; item_n++)
+        {
+            const char* item_text = fs->TextUpper.Data + fs->TextOffsets[item_n];
+            for (const char* p = item_text; p[0] && p[1] && p[2]; p++)
+            {
+                const int bucket_n = ComboFilterTrigramBucket(p);
+                if (last_item[bucket_n] == item_n)
+                    continue;
+                last_item[bucket_n] = item_n;
+                if (pass == 0)
+                    fs->BucketStarts[bucket_n]++;
+                else
+                    fs->BucketItems[write_offsets[bucket_n]++] = item_n;
+            }
+        }
+    }
+}
+
+static void ComboFilterUpdateResults(ImGuiComboFilterState* fs)
+{
+    ImStrncpy(fs->FilterApplied, fs->Filter, IM_ARRAYSIZE(fs->FilterApplied));
+    fs->Results.resize(0);
+    char filter[IM_ARRAYSIZE(fs->Filter)];
+    int filter_len = 0;
+    for (const char* p = fs->Filter; *p; p++)
+        filter[filter_len++] = ImToUpper(*p);
+    filter[filter_len] = 0;
+    if (filter_len == 0)
+        return;
+
+    if (filter_len < 3)
+    {
+        for (int item_n = 0; item_n < fs->ItemsCount; item_n++)
+            if (strstr(fs->TextUpper.Data + fs->TextOffsets[item_n], filter) != NULL)
+                fs->Results.push_back(item_n);
+        return;
+    }
+
+    // Every matching item contains all trigrams of the filter: test items of the smallest bucket
+    int best_bucket_n = -1;
+    for (const char* p = filter; p[2]; p++)
+    {
+        const int bucket_n = ComboFilterTrigramBucket(p);
+        if (best_bucket_n == -1 || fs->BucketStarts[bucket_n + 1] - fs->BucketStarts[bucket_n] < fs->BucketStarts[best_bucket_n + 1] - fs->BucketStarts[best_bucket_n])
+            best_bucket_n = bucket_n;
+    }
+    for (int n = fs->BucketStarts[best_bucket_n]; n < fs->BucketStarts[best_bucket_n + 1]; n++)
+    {
+        const int item_n = fs->BucketItems[n];
+        if (strstr(fs->TextUpper.Data + fs->TextOffsets[item_n], filter) != NULL)
+            fs->Results.push_back(item_n);
+    }
+}
+
+// Combo with a filter field at the top of the popup. Matching is case-insensitive (ASCII) and finds the filter anywhere in item text.
+// Only one index is kept (for the last opened combo) as a single popup may be open at a time.
+bool ImGui::ComboFiltered(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, int data_version, int popup_max_height_in_items)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    const ImGuiID id = window->GetID(label);
+
+    const char* preview_value = NULL;
+    if (*current_item >= 0 && *current_item < items_count)
+        preview_value = getter(user_data, *current_item);
+
+    if (popup_max_height_in_items != -1 && !(g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasSizeConstraint))
+        SetNextWindowSizeConstraints(ImVec2(0, 0), ImVec2(FLT_MAX, CalcMaxPopupHeightFromItemCount(popup_max_height_in_items + 1)));
+
+    if (!BeginCombo(label, preview_value, ImGuiComboFlags_None))
+        return false;
+
+    // Build index lazily
+    ImGuiComboFilterState* fs = &g.ComboFilterState;
+    if (fs->ID != id || fs->DataVersion != data_version || fs->ItemsCount != items_count)
+    {
+        fs->ID = id;
+        fs->DataVersion = data_version;
+        fs->ItemsCount = items_count;
+        ComboFilterBuildIndex(fs, getter, user_data, items_count);
+        fs->FilterApplied[0] = 0;
+        fs->Results.resize(0);
+    }
+    if (IsWindowAppearing())
+    {
+        fs->Filter[0] = 0;
+        SetKeyboardFocusHere();
+    }
+
+    // Filter
+    bool value_changed = false;
+    SetNextItemWidth(-FLT_MIN);
+    const bool filter_validated = InputTextWithHint("##Filter", "Filter", fs->Filter, IM_ARRAYSIZE(fs->Filter), ImGuiInputTextFlags_EnterReturnsTrue);
+    if (strcmp(fs->Filter, fs->FilterApplied) != 0)
+        ComboFilterUpdateResults(fs);
+    const bool is_filtering = fs->Filter[0] != 0;
+    const int display_count = is_filtering ? fs->Results.Size : items_count;
+    if (filter_validated && display_count > 0)
+    {
+        // Enter selects the first match
+        const int item_n = is_filtering ? fs->Results[0] : 0;
+        value_changed = (*current_item != item_n);
+        *current_item = item_n;
+        CloseCurrentPopup();
+    }
+
+    // Display items
+    ImGuiListClipper clipper;
+    clipper.Begin(display_count);
+    if (!is_filtering)
+        clipper.IncludeItemByIndex(*current_item);
+    while (clipper.Step())
+        for (int display_n = clipper.DisplayStart; display_n < clipper.DisplayEnd; display_n++)
+        {
+            const int item_n = is_filtering ? fs->Results[display_n] : display_n;
+            const char* item_text = getter(user_data, item_n);
+            if (item_text == NULL)
+                item_text = "*Unknown item*";
+
+            PushID(item_n);
+            const bool item_selected = (item_n == *current_item);
+            if (Selectable(item_text, item_selected) && *current_item != item_n)
+            {
+                value_changed = true;
+                *current_item = item_n;
+            }
+            if (item_selected && !is_filtering)
+                SetItemDefaultFocus();
+            PopID();
+        }
+
+    EndCombo();
+    if (value_changed)
+        MarkItemEdited(id);
+
+    return value_changed;
+}
+
 // Combo box helper allowing to pass an array of strings.
 bool ImGui::Combo(const char* label, int* current_item, const char* const items[], int items_count, int height_in_items)
 {
@@ -2672,7 +2862,7 @@ bool ImGui::DragScalar(const char* label, ImGuiDataType data_type, void* p_data,
     const ImGuiID id = window->GetID(label);
     const float w = CalcItemWidth();
 
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
     const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + ImVec2(w, label_size.y + style.FramePadding.y * 2.0f));
     const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0.0f));
 
@@ -3276,7 +3466,7 @@ bool ImGui::SliderScalar(const char* label, ImGuiDataType data_type, void* p_dat
     const ImGuiID id = window->GetID(label);
     const float w = CalcItemWidth();
 
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
     const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + ImVec2(w, label_size.y + style.FramePadding.y * 2.0f));
     const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0.0f));
 
@@ -3448,7 +3638,7 @@ bool ImGui::VSliderScalar(const char* label, const ImVec2& size, ImGuiDataType d
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
 
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
     const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + size);
     const ImRect bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0.0f));
 
@@ -4030,6 +4220,81 @@ static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* ob
     r->num_chars = (int)(text_remaining - (text + line_start_idx));
 }
 
+// Row index for multi-line: every row produced by STB_TEXTEDIT_LAYOUTROW() above is one '\n'-terminated line of height g.FontSize,
+// so stb_textedit.h row searches can jump near their target instead of laying out all rows from the top of the text.
+// obj->LineStarts[] is extended lazily (memchr() over the text) and truncated on edits, so it only ever covers what has been queried.
+static void InputTextLineStartsInvalidate(ImGuiInputTextState* obj, int pos)
+{
+    // Lines starting at or before 'pos' are unaffected by an edit at 'pos'
+    ImVector<int>& line_starts = obj->LineStarts;
+    int lo = 0, hi = line_starts.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (line_starts.Data[mid] <= pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    line_starts.resize(lo);
+}
+
+// Extend index until it contains line 'line_no' and a line starting after 'pos', or reaches end of text. Return number of indexed lines.
+static int InputTextLineStartsBuild(ImGuiInputTextState* obj, int line_no, int pos)
+{
+    ImVector<int>& line_starts = obj->LineStarts;
+    if (line_starts.Size == 0)
+        line_starts.push_back(0);
+    while (line_starts.Size <= line_no || line_starts.back() <= pos)
+    {
+        const int line_start = line_starts.back();
+        const char* line_end = (const char*)memchr(obj->TextSrc + line_start, '\n', (size_t)(obj->TextLen - line_start));
+        if (line_end == NULL)
+            break;
+        line_starts.push_back((int)(line_end + 1 - obj->TextSrc));
+    }
+    return line_starts.Size;
+}
+
+static void STB_TEXTEDIT_SEEKROW_Y_IMPL(ImGuiInputTextState* obj, float y, int* out_line_start, float* out_y)
+{
+    // Stop one row early: stb_textedit.h lays out the final rows, which keeps its exact semantic at row boundaries.
+    const float line_height = obj->Ctx->FontSize;
+    if (obj->Stb->single_line || line_height <= 0.0f || y < line_height * 2.0f)
+        return;
+    int line_no = (int)(y / line_height) - 1;
+    line_no = ImMin(line_no, InputTextLineStartsBuild(obj, line_no, -1) - 1);
+    *out_line_start = obj->LineStarts[line_no];
+    *out_y = line_no * line_height;
+}
+
+static void STB_TEXTEDIT_SEEKROW_CHAR_IMPL(ImGuiInputTextState* obj, int n, int* out_line_start, int* out_prev_line_start, float* out_y)
+{
+    // Land on the row before the one containing 'n', so stb_textedit.h still handles the last line and trailing '\n' cases.
+    if (obj->Stb->single_line || n <= 0)
+        return;
+    InputTextLineStartsBuild(obj, 0, n);
+    const ImVector<int>& line_starts = obj->LineStarts;
+    int lo = 0, hi = line_starts.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (line_starts.Data[mid] <= n)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    const int line_no = lo - 2; // lo - 1 is the line containing 'n'
+    if (line_no <= 0)
+        return;
+    *out_line_start = line_starts[line_no];
+    *out_prev_line_start = line_starts[line_no - 1];
+    *out_y = line_no * obj->Ctx->FontSize;
+}
+
+#define IMSTB_TEXTEDIT_SEEKROW_Y        STB_TEXTEDIT_SEEKROW_Y_IMPL
+#define IMSTB_TEXTEDIT_SEEKROW_CHAR     STB_TEXTEDIT_SEEKROW_CHAR_IMPL
+
 #define IMSTB_TEXTEDIT_GETNEXTCHARINDEX  IMSTB_TEXTEDIT_GETNEXTCHARINDEX_IMPL
 #define IMSTB_TEXTEDIT_GETPREVCHARINDEX  IMSTB_TEXTEDIT_GETPREVCHARINDEX_IMPL
 
@@ -4132,6 +4397,7 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
     memmove(dst, src, obj->TextLen - n - pos + 1);
     obj->Edited = true;
     obj->TextLen -= n;
+    InputTextLineStartsInvalidate(obj, pos);
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const char* new_text, int new_text_len)
@@ -4161,6 +4427,7 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ch
     obj->Edited = true;
     obj->TextLen += new_text_len;
     obj->TextA[obj->TextLen] = '\0';
+    InputTextLineStartsInvalidate(obj, pos);
 
     return true;
 }
@@ -4319,13 +4586,42 @@ void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
     ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(backup->IndexPages.Size == 0);
     ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
+    if (g.Font->ContainerAtlas->SharedData != NULL)
+    {
+        // Shared font atlas: other threads may be reading g.Font/g.FontBaked, so we cannot patch them.
+        // Use a context-local font with a single glyph instead. Glyph loading is disabled so every lookup returns it.
+        ImFont* font = &g.InputTextPasswordFont;
+        ImFontBaked* baked = &g.InputTextPasswordFontBaked;
+        font->ContainerAtlas = g.Font->ContainerAtlas;
+        font->Flags = g.Font->Flags | ImFontFlags_NoLoadGlyphs;
+        font->FontId = g.Font->FontId;
+        font->LegacySize = g.Font->LegacySize;
+        font->CurrentRasterizerDensity = g.FontBaked->RasterizerDensity;
+        font->FallbackChar = (ImWchar)'*';
+        font->EllipsisChar = g.Font->EllipsisChar;
+        font->LastBaked = baked;
+        baked->Glyphs.resize(1);
+        baked->Glyphs[0] = *glyph;
+        baked->FallbackGlyphIndex = 0;
+        baked->FallbackAdvanceX = glyph->AdvanceX;
+        baked->Size = g.FontBaked->Size;
+        baked->RasterizerDensity = g.FontBaked->RasterizerDensity;
+        baked->Ascent = g.FontBaked->Ascent;
+        baked->Descent = g.FontBaked->Descent;
+        baked->BakedId = g.FontBaked->BakedId;
+        baked->ContainerFont = font;
+        g.InputTextPasswordFontBackupFont = g.Font;
+        g.InputTextPasswordFontBackupFontBaked = g.FontBaked;
+        g.Font = font;
+        g.FontBaked = baked;
+        return;
+    }
     g.InputTextPasswordFontBackupFlags = g.Font->Flags;
     backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
     backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
-    backup->IndexLookup.swap(g.FontBaked->IndexLookup);
-    backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
+    backup->IndexPages.swap(g.FontBaked->IndexPages);
     g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
     g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
     g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
@@ -4334,13 +4630,22 @@ void ImGui::PushPasswordFont()
 void ImGui::PopPasswordFont()
 {
     ImGuiContext& g = *GImGui;
+    if (g.Font == &g.InputTextPasswordFont)
+    {
+        g.Font = g.InputTextPasswordFontBackupFont;
+        g.FontBaked = g.InputTextPasswordFontBackupFontBaked;
+        g.InputTextPasswordFont.ContainerAtlas = NULL; // Our ImFont destructor must not discard bakes from the atlas
+        g.InputTextPasswordFont.LastBaked = NULL;
+        g.InputTextPasswordFontBackupFont = NULL;
+        g.InputTextPasswordFontBackupFontBaked = NULL;
+        return;
+    }
     ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
     g.Font->Flags = g.InputTextPasswordFontBackupFlags;
     g.FontBaked->FallbackGlyphIndex = backup->FallbackGlyphIndex;
     g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
-    g.FontBaked->IndexLookup.swap(backup->IndexLookup);
-    g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    g.FontBaked->IndexPages.swap(backup->IndexPages);
+    IM_ASSERT(backup->IndexPages.Size == 0);
 }
 
 // Return false to discard a character.
@@ -4530,7 +4835,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     if (is_multiline) // Open group before calling GetID() because groups tracks id created within their scope (including the scrollbar)
         BeginGroup();
     const ImGuiID id = window->GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
     const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), (is_multiline ? g.FontSize * 8.0f : label_size.y) + style.FramePadding.y * 2.0f); // Arbitrary default of 8 lines high for multi-line
     const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
 
@@ -4632,6 +4937,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
         state->TextLen = new_len;
         memcpy(state->TextA.Data, buf, state->TextLen + 1);
+        state->LineStarts.resize(0);
         state->Stb->select_start = state->ReloadSelectionStart;
         state->Stb->cursor = state->Stb->select_end = state->ReloadSelectionEnd;
         state->CursorClamp();
@@ -4661,6 +4967,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // Start edition
         state->ID = id;
         state->TextLen = buf_len;
+        state->LineStarts.resize(0);
         if (!is_readonly)
         {
             state->TextA.resize(buf_size + 1); // we use +1 to make sure that .Data is always pointing to at least an empty string.
@@ -4738,6 +5045,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
     if (state != NULL)
         state->TextSrc = is_readonly ? buf : state->TextA.Data;
+    if (state != NULL && is_readonly)
+        state->LineStarts.resize(0); // Source buffer may have been modified since last frame.
 
     // We have an edge case if ActiveId was set through another widget (e.g. widget being swapped), clear id immediately (don't wait until the end of the function)
     if (g.ActiveId == id && state == NULL)
@@ -5156,6 +5465,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         IM_ASSERT(callback_data.BufTextLen == (int)ImStrlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
                         InputTextReconcileUndoState(state, state->CallbackTextBackup.Data, state->CallbackTextBackup.Size - 1, callback_data.Buf, callback_data.BufTextLen);
                         state->TextLen = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        state->LineStarts.resize(0);
                         state->CursorAnimReset();
                     }
                 }
@@ -6456,6 +6766,8 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - ImGuiVirtualTree
+// - VirtualTreeNode()
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -7103,6 +7415,159 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+ImGuiVirtualTree::ImGuiVirtualTree()
+{
+    UserData = NULL;
+    AdapterGetChildCount = NULL;
+    AdapterGetChild = NULL;
+    AdapterGetNodeId = NULL;
+    NeedRebuild = true;
+}
+
+ImGuiID ImGuiVirtualTree::GetNodeId(void* node)
+{
+    return AdapterGetNodeId ? AdapterGetNodeId(this, node) : ImHashData(&node, sizeof(node));
+}
+
+bool ImGuiVirtualTree::IsNodeOpen(ImGuiID node_id) const
+{
+    return OpenStorage.GetInt(node_id, 0) != 0;
+}
+
+// Append visible descendants of 'node' to _TempRows, in display order.
+// Iterative so that deep hierarchies can't overflow the stack: _TempStack holds (index of parent row in _TempRows or -1 for 'node', next child index) pairs.
+static void VirtualTreeAddSubtreeRows(ImGuiVirtualTree* tree, void* node, int node_child_count, int depth)
+{
+    ImVector<ImGuiVirtualTreeRow>& out = tree->_TempRows;
+    ImVector<int>& stack = tree->_TempStack;
+    out.resize(0);
+    stack.resize(0);
+    stack.push_back(-1);
+    stack.push_back(0);
+    while (stack.Size > 0)
+    {
+        const int parent_row_n = stack[stack.Size - 2];
+        const int child_n = stack[stack.Size - 1];
+        void* parent_node = (parent_row_n == -1) ? node : out[parent_row_n].Node;
+        const int parent_child_count = (parent_row_n == -1) ? node_child_count : out[parent_row_n].ChildCount;
+        const int parent_depth = (parent_row_n == -1) ? depth - 1 : out[parent_row_n].Depth;
+        if (child_n >= parent_child_count)
+        {
+            stack.resize(stack.Size - 2);
+            continue;
+        }
+        stack[stack.Size - 1] = child_n + 1;
+
+        ImGuiVirtualTreeRow row;
+        row.Node = tree->AdapterGetChild(tree, parent_node, child_n);
+        row.NodeId = tree->GetNodeId(row.Node);
+        row.Depth = parent_depth + 1;
+        row.ChildCount = tree->AdapterGetChildCount(tree, row.Node);
+        out.push_back(row);
+        if (row.ChildCount > 0 && tree->IsNodeOpen(row.NodeId))
+        {
+            stack.push_back(out.Size - 1);
+            stack.push_back(0);
+        }
+    }
+}
+
+void ImGuiVirtualTree::Rebuild()
+{
+    IM_ASSERT(AdapterGetChildCount != NULL && AdapterGetChild != NULL);
+    VirtualTreeAddSubtreeRows(this, NULL, AdapterGetChildCount(this, NULL), 0);
+    Rows.swap(_TempRows);
+    _TempRows.resize(0);
+    _PendingToggles.resize(0);
+    NeedRebuild = false;
+}
+
+void ImGuiVirtualTree::SetRowOpen(int row_n, bool open)
+{
+    IM_ASSERT(row_n >= 0 && row_n < Rows.Size);
+    const ImGuiVirtualTreeRow row = Rows[row_n];
+    if (IsNodeOpen(row.NodeId) == open)
+        return;
+    OpenStorage.SetInt(row.NodeId, open ? 1 : 0);
+    if (row.ChildCount == 0)
+        return;
+    if (open)
+    {
+        // Insert visible subtree after the row
+        VirtualTreeAddSubtreeRows(this, row.Node, row.ChildCount, row.Depth + 1);
+        const int insert_count = _TempRows.Size;
+        const int tail_count = Rows.Size - (row_n + 1);
+        Rows.resize(Rows.Size + insert_count);
+        memmove(Rows.Data + row_n + 1 + insert_count, Rows.Data + row_n + 1, (size_t)tail_count * sizeof(ImGuiVirtualTreeRow));
+        memcpy(Rows.Data + row_n + 1, _TempRows.Data, (size_t)insert_count * sizeof(ImGuiVirtualTreeRow));
+        _TempRows.resize(0);
+    }
+    else
+    {
+        // Remove following rows which are deeper than the row
+        int row_end = row_n + 1;
+        while (row_end < Rows.Size && Rows[row_end].Depth > row.Depth)
+            row_end++;
+        Rows.erase(Rows.Data + row_n + 1, Rows.Data + row_end);
+    }
+}
+
+static int IMGUI_CDECL VirtualTreeRowIndexComparerDescending(const void* lhs, const void* rhs)
+{
+    return *(const int*)rhs - *(const int*)lhs;
+}
+
+int ImGuiVirtualTree::Update()
+{
+    if (NeedRebuild)
+        Rebuild();
+
+    // Apply from last to first row: opening/closing a row only shifts rows which come after it.
+    if (_PendingToggles.Size > 1)
+        ImQsort(_PendingToggles.Data, (size_t)_PendingToggles.Size, sizeof(int), VirtualTreeRowIndexComparerDescending);
+    for (int n = 0; n < _PendingToggles.Size; n++)
+    {
+        const int row_n = _PendingToggles[n];
+        if (n > 0 && row_n == _PendingToggles[n - 1])
+            continue;
+        if (row_n < Rows.Size)
+            SetRowOpen(row_n, !IsNodeOpen(Rows[row_n].NodeId));
+    }
+    _PendingToggles.resize(0);
+    return Rows.Size;
+}
+
+// Open state is owned by the ImGuiVirtualTree: it is injected with SetNextItemOpen() and all rows share a single window storage slot,
+// so the window storage doesn't grow with the number of nodes ever displayed.
+bool ImGui::VirtualTreeNode(ImGuiVirtualTree* tree, int row_n, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(row_n >= 0 && row_n < tree->Rows.Size);
+    const ImGuiVirtualTreeRow& row = tree->Rows[row_n];
+    const bool was_open = row.ChildCount > 0 && tree->IsNodeOpen(row.NodeId);
+    const float indent = row.Depth * g.Style.IndentSpacing;
+    if (indent > 0.0f)
+        Indent(indent);
+
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (row.ChildCount == 0)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    const ImGuiID id = window->GetID((int)row.NodeId);
+    SetNextItemStorageID(window->GetID("#VIRTUALTREE"));
+    SetNextItemOpen(was_open, ImGuiCond_Always);
+    const bool is_open = TreeNodeBehavior(id, flags, label);
+    if (is_open != was_open && row.ChildCount > 0)
+        tree->_PendingToggles.push_back(row_n);
+
+    if (indent > 0.0f)
+        Unindent(indent);
+    return is_open;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -7124,7 +7589,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
 
     // Submit label or explicit size to ItemSize(), whereas ItemAdd() will submit a larger/spanning rectangle.
     ImGuiID id = window->GetID(label);
-    ImVec2 label_size = CalcTextSize(label, NULL, true);
+    ImVec2 label_size = CalcItemLabelSize(id, label);
     ImVec2 size(size_arg.x != 0.0f ? size_arg.x : label_size.x, size_arg.y != 0.0f ? size_arg.y : label_size.y);
     ImVec2 pos = window->DC.CursorPos;
     pos.y += window->DC.CurrLineTextBaseOffset;
@@ -8451,7 +8916,7 @@ bool ImGui::BeginListBox(const char* label, const ImVec2& size_arg)
 
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = GetID(label);
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
 
     // Size default to hold ~7.25 items.
     // Fractional number of items helps seeing that we can scroll down/up without looking at scrollbar.
@@ -8553,6 +9018,8 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotStream
+// - PlotLinesStream()
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -8570,7 +9037,7 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
 
-    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
     const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
 
     const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
@@ -8713,6 +9180,265 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+ImGuiPlotStream::ImGuiPlotStream(int capacity)
+{
+    TempData = NULL;
+    SetCapacity(capacity);
+}
+
+ImGuiPlotStream::~ImGuiPlotStream()
+{
+    if (ImGuiPlotStreamCache* cache = (ImGuiPlotStreamCache*)TempData)
+        IM_DELETE(cache);
+}
+
+void ImGuiPlotStream::SetCapacity(int capacity)
+{
+    IM_ASSERT(capacity >= 0);
+    Values.resize(capacity);
+    Clear();
+}
+
+void ImGuiPlotStream::Clear()
+{
+    Count = Head = 0;
+    RangeMin = FLT_MAX;
+    RangeMax = -FLT_MAX;
+    _RangeRefitCounter = 0;
+    _NewCount = 0;
+    if (ImGuiPlotStreamCache* cache = (ImGuiPlotStreamCache*)TempData)
+        cache->NeedRebuild = true;
+}
+
+void ImGuiPlotStream::AddSample(float v)
+{
+    IM_ASSERT(Values.Size > 0 && "Call SetCapacity() first!");
+    Values.Data[Head] = v;
+    Head = (Head + 1 == Values.Size) ? 0 : Head + 1;
+    Count = ImMin(Count + 1, Values.Size);
+    _NewCount = ImMin(_NewCount + 1, Values.Size);
+
+    // Grow range to fit new sample. Any change of range makes PlotLinesStream() rebuild its cached geometry, so the range grows
+    // with a margin of 25% of its size: drifting or monotonic data then only causes a rebuild after moving by a quarter of the range.
+    if (v == v && (v < RangeMin || v > RangeMax))
+    {
+        const float new_min = ImMin(RangeMin, v);
+        const float new_max = ImMax(RangeMax, v);
+        const float margin = (new_max - new_min) * 0.25f;
+        RangeMin = (v < RangeMin) ? new_min - margin : new_min;
+        RangeMax = (v > RangeMax) ? new_max + margin : new_max;
+    }
+
+    // Refitting requires scanning all samples: only do it every Values.Size samples.
+    // Keep the current range while samples use at least half of it, so the refit doesn't cause a rebuild every time either.
+    if (++_RangeRefitCounter >= Values.Size)
+    {
+        float samples_min = FLT_MAX;
+        float samples_max = -FLT_MAX;
+        for (int n = 0; n < Count; n++)
+        {
+            const float sample = GetSample(n);
+            if (sample != sample) // Ignore NaN values
+                continue;
+            samples_min = ImMin(samples_min, sample);
+            samples_max = ImMax(samples_max, sample);
+        }
+        if (samples_max - samples_min < (RangeMax - RangeMin) * 0.5f)
+        {
+            RangeMin = samples_min;
+            RangeMax = samples_max;
+        }
+        _RangeRefitCounter = 0;
+    }
+}
+
+// Same output as PlotLines() with one line segment per sample, but the newest sample is always on the right edge of the frame.
+// - Segments added since last call are tessellated with AddLine() into a scratch draw list, and copied into ImGuiPlotStreamCache.
+// - Cached segments are copied into the window draw list with a translation. Draw lists are rebuilt every frame so this is still
+//   O(samples), but it is a straight copy instead of tessellating every segment again.
+void ImGui::PlotLinesStream(const char* label, ImGuiPlotStream* stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+
+    const ImVec2 label_size = CalcItemLabelSize(id, label);
+    const ImVec2 frame_size = CalcItemSize(graph_size, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_NoNav))
+        return;
+    bool hovered;
+    ButtonBehavior(frame_bb, id, &hovered, NULL);
+
+    if (scale_min == FLT_MAX)
+        scale_min = stream->RangeMin;
+    if (scale_max == FLT_MAX)
+        scale_max = stream->RangeMax;
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    const int values_count = stream->Count;
+    if (values_count >= 2)
+    {
+        if (stream->TempData == NULL)
+            stream->TempData = IM_NEW(ImGuiPlotStreamCache)();
+        ImGuiPlotStreamCache* cache = (ImGuiPlotStreamCache*)stream->TempData;
+        ImDrawList* draw_list = window->DrawList;
+        ImDrawListSharedData* shared_data = &g.DrawListSharedData;
+
+        const ImVec2 inner_size = inner_bb.GetSize();
+        const float x_step = inner_size.x / (float)(stream->Values.Size - 1);
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        const ImU32 col_base = GetColorU32(ImGuiCol_PlotLines);
+        const ImU32 col_hovered = GetColorU32(ImGuiCol_PlotLinesHovered);
+
+        // Rebuild everything when tessellation parameters changed
+        const ImDrawListFlags draw_list_flags = draw_list->Flags & ~ImDrawListFlags_CullOffscreen;
+        const ImVec4 tex_uv_lines = shared_data->TexUvLines ? shared_data->TexUvLines[1] : ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+        if (cache->Size.x != inner_size.x || cache->Size.y != inner_size.y || cache->ScaleMin != scale_min || cache->ScaleMax != scale_max || cache->Col != col_base
+            || cache->Flags != draw_list_flags || cache->FringeScale != draw_list->_FringeScale
+            || cache->TexUvWhitePixel.x != shared_data->TexUvWhitePixel.x || cache->TexUvWhitePixel.y != shared_data->TexUvWhitePixel.y
+            || memcmp(&cache->TexUvLines, &tex_uv_lines, sizeof(ImVec4)) != 0)
+            cache->NeedRebuild = true;
+        if (cache->NeedRebuild)
+        {
+            cache->Size = inner_size;
+            cache->ScaleMin = scale_min;
+            cache->ScaleMax = scale_max;
+            cache->Col = col_base;
+            cache->Flags = draw_list_flags;
+            cache->FringeScale = draw_list->_FringeScale;
+            cache->TexUvWhitePixel = shared_data->TexUvWhitePixel;
+            cache->TexUvLines = tex_uv_lines;
+            cache->NewestX = 0.0f;
+            cache->VtxPerSegment = 0;
+            stream->_NewCount = values_count;
+            cache->NeedRebuild = false;
+        }
+
+        // Keep positions small to preserve float precision: move origin back to the newest sample once in a while.
+        const int new_segment_count = ImMin(stream->_NewCount, values_count - 1);
+        if (cache->NewestX + x_step * new_segment_count > ImMax(inner_size.x * 4.0f, 4096.0f))
+        {
+            const float offset_x = cache->NewestX;
+            for (ImDrawVert& vtx : cache->SegVtx)
+                vtx.pos.x -= offset_x;
+            cache->NewestX = 0.0f;
+        }
+
+        // Tessellate new segments
+        // (segment 'seg_n' goes from sample 'seg_n' to sample 'seg_n + 1', and is stored at the position of its first sample in Values[])
+        const int values_size = stream->Values.Size;
+        const int oldest_n = stream->Head - values_count < 0 ? stream->Head - values_count + values_size : stream->Head - values_count;
+        if (new_segment_count > 0)
+        {
+            // (scratch draw list is not registered into shared data, as ImGuiPlotStream may outlive the context)
+            if (cache->TessDrawList == NULL)
+                cache->TessDrawList = IM_NEW(ImDrawList)(NULL);
+            ImDrawList* tess_draw_list = cache->TessDrawList;
+            tess_draw_list->_Data = shared_data;
+            tess_draw_list->_ResetForNewFrame();
+            tess_draw_list->Flags = draw_list_flags;
+            tess_draw_list->_FringeScale = draw_list->_FringeScale;
+
+            const int seg_n_start = values_count - 1 - new_segment_count;
+            for (int seg_n = seg_n_start; seg_n < values_count - 1; seg_n++)
+            {
+                const float x0 = cache->NewestX + x_step * (seg_n - seg_n_start);
+                const float y0 = (1.0f - ImSaturate((stream->GetSample(seg_n) - scale_min) * inv_scale)) * inner_size.y;
+                const float y1 = (1.0f - ImSaturate((stream->GetSample(seg_n + 1) - scale_min) * inv_scale)) * inner_size.y;
+                tess_draw_list->AddLine(ImVec2(x0, y0), ImVec2(x0 + x_step, y1), col_base);
+            }
+
+            // All segments are tessellated the same way, only their vertices positions differ
+            if (cache->VtxPerSegment == 0)
+            {
+                cache->VtxPerSegment = tess_draw_list->VtxBuffer.Size / new_segment_count;
+                cache->SegIdx.resize(tess_draw_list->IdxBuffer.Size / new_segment_count);
+                if (cache->SegIdx.Size > 0)
+                    memcpy(cache->SegIdx.Data, tess_draw_list->IdxBuffer.Data, (size_t)cache->SegIdx.Size * sizeof(ImDrawIdx));
+                cache->SegVtx.resize(values_size * cache->VtxPerSegment);
+            }
+            const int vtx_per_segment = cache->VtxPerSegment;
+            IM_ASSERT(tess_draw_list->VtxBuffer.Size == new_segment_count * vtx_per_segment);
+            for (int seg_n = seg_n_start; seg_n < values_count - 1; seg_n++)
+            {
+                const int slot_n = (oldest_n + seg_n) % values_size;
+                memcpy(&cache->SegVtx.Data[slot_n * vtx_per_segment], &tess_draw_list->VtxBuffer.Data[(seg_n - seg_n_start) * vtx_per_segment], (size_t)vtx_per_segment * sizeof(ImDrawVert));
+            }
+            cache->NewestX += x_step * new_segment_count;
+            tess_draw_list->_Data = NULL;
+        }
+        stream->_NewCount = 0;
+
+        // Tooltip on hover
+        const float oldest_x = inner_bb.Max.x - x_step * (values_count - 1);
+        int seg_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos) && g.IO.MousePos.x >= oldest_x)
+        {
+            seg_hovered = ImClamp((int)((g.IO.MousePos.x - oldest_x) / x_step), 0, values_count - 2);
+            SetTooltip("%d: %8.4g\n%d: %8.4g", seg_hovered, stream->GetSample(seg_hovered), seg_hovered + 1, stream->GetSample(seg_hovered + 1));
+        }
+
+        // Copy cached segments, translated to their current position.
+        // Reserve in batches so 16-bit indices can use a new ImDrawCmd::VtxOffset when needed.
+        const int vtx_per_segment = cache->VtxPerSegment;
+        const int idx_per_segment = cache->SegIdx.Size;
+        if (vtx_per_segment > 0)
+        {
+            const ImVec2 offset(inner_bb.Max.x - cache->NewestX, inner_bb.Min.y);
+            const int batch_max = (sizeof(ImDrawIdx) == 2) ? ImMax(1, 0xFFFF / vtx_per_segment) : values_count;
+            for (int batch_start = 0; batch_start < values_count - 1; batch_start += batch_max)
+            {
+                const int batch_end = ImMin(batch_start + batch_max, values_count - 1);
+                const int batch_count = batch_end - batch_start - ((seg_hovered >= batch_start && seg_hovered < batch_end) ? 1 : 0);
+                draw_list->PrimReserve(batch_count * idx_per_segment, batch_count * vtx_per_segment);
+                for (int seg_n = batch_start; seg_n < batch_end; seg_n++)
+                {
+                    if (seg_n == seg_hovered)
+                        continue;
+                    const ImDrawVert* src_vtx = &cache->SegVtx.Data[((oldest_n + seg_n) % values_size) * vtx_per_segment];
+                    ImDrawVert* dst_vtx = draw_list->_VtxWritePtr;
+                    for (int n = 0; n < vtx_per_segment; n++)
+                    {
+                        dst_vtx[n] = src_vtx[n];
+                        dst_vtx[n].pos.x += offset.x;
+                        dst_vtx[n].pos.y += offset.y;
+                    }
+                    for (int n = 0; n < idx_per_segment; n++)
+                        draw_list->_IdxWritePtr[n] = (ImDrawIdx)(draw_list->_VtxCurrentIdx + cache->SegIdx.Data[n]);
+                    draw_list->_VtxWritePtr += vtx_per_segment;
+                    draw_list->_IdxWritePtr += idx_per_segment;
+                    draw_list->_VtxCurrentIdx += vtx_per_segment;
+                }
+            }
+        }
+
+        // Hovered segment is drawn separately
+        if (seg_hovered != -1)
+        {
+            const ImVec2 pos0(oldest_x + x_step * seg_hovered, inner_bb.Min.y + (1.0f - ImSaturate((stream->GetSample(seg_hovered) - scale_min) * inv_scale)) * inner_size.y);
+            const ImVec2 pos1(pos0.x + x_step, inner_bb.Min.y + (1.0f - ImSaturate((stream->GetSample(seg_hovered + 1) - scale_min) * inv_scale)) * inner_size.y);
+            draw_list->AddLine(pos0, pos1, col_hovered);
+        }
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -5,6 +5,7 @@
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000 + #6783)
 // - Added name to struct or it may be forward declared in our code.
 // - Added UTF-8 support (see https://github.com/nothings/stb/issues/188 + https://github.com/ocornut/imgui/pull/7925)
+// - Added optional IMSTB_TEXTEDIT_SEEKROW_Y/IMSTB_TEXTEDIT_SEEKROW_CHAR hooks so row searches don't need to start from the top of the text.
 // Grep for [DEAR IMGUI] to find the changes.
 // - Also renamed macros used or defined outside of IMSTB_TEXTEDIT_IMPLEMENTATION block from STB_TEXTEDIT_* to IMSTB_TEXTEDIT_*
 
@@ -421,6 +422,13 @@ typedef struct
 #define IMSTB_TEXTEDIT_GETNEXTCHARINDEX(OBJ, IDX) ((IDX) + 1)
 #endif
 
+// [DEAR IMGUI]
+// Optional hooks to skip rows when searching from the top of the text, for large multi-line texts.
+// - IMSTB_TEXTEDIT_SEEKROW_Y(OBJ, Y, &I, &BASE_Y): move I/BASE_Y to the start/top of a row such that all rows before it end above Y.
+// - IMSTB_TEXTEDIT_SEEKROW_CHAR(OBJ, N, &I, &PREV_START, &Y): move I/Y to the start/top of a row before the one containing N,
+//   PREV_START to the start of the row before I. Never move to the last row, or to the row containing N.
+// Leave values untouched to perform a full search.
+
 /////////////////////////////////////////////////////////////////////////////
 //
 //      Mouse input handling
@@ -438,6 +446,10 @@ static int stb_text_locate_coord(IMSTB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+#ifdef IMSTB_TEXTEDIT_SEEKROW_Y
+   IMSTB_TEXTEDIT_SEEKROW_Y(str, y, &i, &base_y); // [DEAR IMGUI]
+#endif
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -567,6 +579,9 @@ static void stb_textedit_find_charpos(StbFindState *find, IMSTB_TEXTEDIT_STRING
 
    // search rows to find the one that straddles character n
    find->y = 0;
+#ifdef IMSTB_TEXTEDIT_SEEKROW_CHAR
+   IMSTB_TEXTEDIT_SEEKROW_CHAR(str, n, &i, &prev_start, &find->y); // [DEAR IMGUI]
+#endif
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -0,0 +1,157 @@
+// Dear ImGui: shared font atlas check (headless, no GPU)
+//
+// Two contexts share a font atlas from two threads (see ImFontAtlas::LockFn).
+// The owner context keeps drawing password fields, which swap in a font that only has the '*' glyph.
+// The other context draws text at changing sizes and checks that it gets real glyphs and can still load new ones.
+// Both contexts use a different rasterizer density (e.g. monitors with different DPI), each must get baked fonts at its own.
+// Not part of the Visual Studio project (it has its own main). It compiles Dear ImGui in, to make GImGui thread-local. Build e.g.:
+//   g++ -std=c++11 example_shared_font_atlas_check.cpp -lpthread
+
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <stdio.h>
+#include <stdint.h>
+
+struct ImGuiContext;
+static thread_local ImGuiContext* MyImGuiTLS = nullptr;
+#define GImGui MyImGuiTLS
+#include "ImGui/imgui.cpp"
+#include "ImGui/imgui_draw.cpp"
+#include "ImGui/imgui_widgets.cpp"
+#include "ImGui/imgui_tables.cpp"
+
+static std::recursive_mutex g_AtlasMutex;
+static void AtlasLock(void*) { g_AtlasMutex.lock(); }
+static void AtlasUnlock(void*) { g_AtlasMutex.unlock(); }
+
+// What a renderer backend supporting ImGuiBackendFlags_RendererHasTextures does with the textures.
+static void RendererUpdateTextures(ImDrawData* draw_data)
+{
+    static std::atomic<int> next_tex_id(1);
+    for (ImTextureData* tex : *draw_data->Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)next_tex_id++);
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+static void RendererShutdown()
+{
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1 && tex->TexID != ImTextureID_Invalid)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+}
+
+static ImGuiContext* CreateHeadlessContext(ImFontAtlas* atlas, float framebuffer_scale)
+{
+    ImGuiContext* ctx = ImGui::CreateContext(atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1280, 800);
+    io.DisplayFramebufferScale = ImVec2(framebuffer_scale, framebuffer_scale);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    return ctx;
+}
+
+static const int FRAMES = 500;
+static std::atomic<bool> g_OwnerDone(false);
+
+// Return number of errors
+static int TextThreadMain(ImFontAtlas* atlas)
+{
+    ImGuiContext* ctx = CreateHeadlessContext(atlas, 2.0f);
+    int errors = 0;
+    for (int frame = 0; frame < FRAMES || !g_OwnerDone; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::Begin("Text");
+        for (int n = 0; n < 20; n++)
+        {
+            // Changing sizes create new baked fonts, changing characters load new glyphs
+            const ImWchar c = (ImWchar)('A' + (frame * 20 + n) % 58);
+            ImGui::PushFont(nullptr, 10.0f + (float)((frame + n) % 40));
+            ImFontBaked* baked = ImGui::GetFontBaked();
+            if ((ImGui::GetFont()->Flags & ImFontFlags_NoLoadGlyphs) || baked->FindGlyph(c)->Codepoint != c || baked->FindGlyph('*')->Codepoint != '*')
+                errors++;
+            if (baked->RasterizerDensity != 2.0f || ImGui::GetFont()->GetFontBaked(ImGui::GetFontSize())->RasterizerDensity != 2.0f)
+                errors++;
+            char buf[2] = { (char)c, 0 };
+            ImGui::TextUnformatted(buf);
+            ImGui::PopFont();
+        }
+        ImGui::End();
+        ImGui::Render();
+        RendererUpdateTextures(ImGui::GetDrawData());
+    }
+    RendererShutdown();
+    ImGui::DestroyContext(ctx);
+    return errors;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    ImGuiContext* owner_ctx = CreateHeadlessContext(nullptr, 1.0f);
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    atlas->LockFn = AtlasLock;
+    atlas->UnlockFn = AtlasUnlock;
+
+    // The owner context needs to start its first frame before other contexts
+    ImGui::NewFrame();
+    ImGui::Render();
+    RendererUpdateTextures(ImGui::GetDrawData());
+
+    int text_thread_errors = 0;
+    std::thread text_thread([&]() { text_thread_errors = TextThreadMain(atlas); });
+
+    int errors = 0;
+    char password[32] = "password";
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::Begin("Password");
+        for (int n = 0; n < 20; n++)
+        {
+            ImGui::PushID(n);
+            ImGui::PushFont(nullptr, 10.0f + (float)((frame + n) % 40));
+            ImGui::InputText("##password", password, IM_ARRAYSIZE(password), ImGuiInputTextFlags_Password);
+            if (ImGui::GetFontBaked()->RasterizerDensity != 1.0f || ImGui::GetFont()->GetFontBaked(ImGui::GetFontSize())->RasterizerDensity != 1.0f)
+                errors++;
+            ImGui::PopFont();
+            ImGui::PopID();
+        }
+        ImGui::End();
+        ImGui::Render();
+        RendererUpdateTextures(ImGui::GetDrawData());
+    }
+    g_OwnerDone = true;
+    text_thread.join();
+
+    // Password glyphs must not have leaked into the shared font either
+    ImFontBaked* baked = ImGui::GetIO().Fonts->Fonts[0]->GetFontBaked(20.0f);
+    if (baked->FindGlyph('a')->Codepoint != 'a')
+        errors++;
+
+    printf("%d frames checked, %d errors in text thread, %d errors in owner thread.\n", FRAMES, text_thread_errors, errors);
+    RendererShutdown();
+    ImGui::DestroyContext(owner_ctx);
+    return (errors + text_thread_errors) == 0 ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+// Dear ImGui: draw data streaming loopback check (headless, no GPU)
+//
+// Runs the demo with imgui_impl_stream as renderer backend, decodes every packet from the same buffer,
+// and compares the decoded draw data with the encoded one: commands and indices must match exactly,
+// vertices within quantization, texture pixels exactly. A second decoder joins late, on a frame uploading new glyphs, to check key frames.
+// Not part of the Visual Studio project (it has its own main). Build e.g.:
+//   g++ -std=c++11 -IImGui example_stream_loopback.cpp ImGui/imgui.cpp ImGui/imgui_draw.cpp ImGui/imgui_tables.cpp ImGui/imgui_widgets.cpp ImGui/imgui_demo.cpp ImGui/imgui_impl_stream.cpp
+
+#include "ImGui/imgui.h"
+#include "ImGui/imgui_impl_stream.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+// What a renderer backend supporting ImGuiBackendFlags_RendererHasTextures does with the decoded textures.
+static void ViewerUpdateTextures(ImDrawData* draw_data)
+{
+    static int next_tex_id = 1;
+    for (ImTextureData* tex : *draw_data->Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)next_tex_id++);
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+static bool HasPendingTextureUpdates(const ImDrawData* draw_data)
+{
+    for (ImTextureData* tex : *draw_data->Textures)
+        if (tex->Status == ImTextureStatus_WantUpdates)
+            return true;
+    return false;
+}
+
+static bool CompareTextures(ImTextureData* src, ImTextureData* dst)
+{
+    if (dst == nullptr || src->Width != dst->Width || src->Height != dst->Height || src->Format != dst->Format)
+        return false;
+    for (int y = 0; y < src->Height; y++)
+        if (memcmp(src->GetPixelsAt(0, y), dst->GetPixelsAt(0, y), (size_t)(src->Width * src->BytesPerPixel)) != 0)
+            return false;
+    return true;
+}
+
+// Return number of mismatches
+static int CompareDrawData(const ImDrawData* src, const ImDrawData* dst)
+{
+    int errors = 0;
+    if (src->CmdLists.Size != dst->CmdLists.Size)
+    {
+        printf("draw list count: %d != %d\n", src->CmdLists.Size, dst->CmdLists.Size);
+        return 1;
+    }
+    for (int list_n = 0; list_n < src->CmdLists.Size; list_n++)
+    {
+        const ImDrawList* a = src->CmdLists[list_n];
+        const ImDrawList* b = dst->CmdLists[list_n];
+        if (a->VtxBuffer.Size != b->VtxBuffer.Size || a->IdxBuffer.Size != b->IdxBuffer.Size)
+        {
+            printf("list %d: buffer sizes differ\n", list_n);
+            errors++;
+            continue;
+        }
+        if (memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.Size * sizeof(ImDrawIdx)) != 0)
+        {
+            printf("list %d: indices differ\n", list_n);
+            errors++;
+        }
+        for (int n = 0; n < a->VtxBuffer.Size; n++)
+        {
+            const ImDrawVert& va = a->VtxBuffer[n];
+            const ImDrawVert& vb = b->VtxBuffer[n];
+            const ImVec2 uva = va.uv, uvb = vb.uv;
+            if (fabsf(va.pos.x - vb.pos.x) > 1.0f / 32.0f + 1e-3f || fabsf(va.pos.y - vb.pos.y) > 1.0f / 32.0f + 1e-3f ||
+                fabsf(uva.x - uvb.x) > 1.0f / 65536.0f || fabsf(uva.y - uvb.y) > 1.0f / 65536.0f || va.col != vb.col)
+            {
+                printf("list %d: vertex %d differs\n", list_n, n);
+                errors++;
+                break;
+            }
+        }
+        int cmd_b = 0;
+        for (const ImDrawCmd& cmd : a->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr)
+                continue; // Not transmitted
+            const ImDrawCmd* cmd2 = (cmd_b < b->CmdBuffer.Size) ? &b->CmdBuffer[cmd_b++] : nullptr;
+            if (cmd2 == nullptr || memcmp(&cmd.ClipRect, &cmd2->ClipRect, sizeof(ImVec4)) != 0 ||
+                cmd.VtxOffset != cmd2->VtxOffset || cmd.IdxOffset != cmd2->IdxOffset || cmd.ElemCount != cmd2->ElemCount)
+            {
+                printf("list %d: command %d differs\n", list_n, cmd_b - 1);
+                errors++;
+                break;
+            }
+            if (cmd.TexRef._TexData != nullptr && !CompareTextures(cmd.TexRef._TexData, cmd2->TexRef._TexData))
+            {
+                printf("list %d: texture of command %d differs\n", list_n, cmd_b - 1);
+                errors++;
+                break;
+            }
+        }
+    }
+    return errors;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1280, 800);
+    ImGui_ImplStream_Init();
+
+    ImGui_ImplStream_Decoder* decoder = ImGui_ImplStream_CreateDecoder();
+    ImGui_ImplStream_Decoder* late_decoder = nullptr;
+    ImVector<unsigned char> packet;
+    int errors = 0;
+    int frames_checked = 0, late_frames_checked = 0;
+
+    for (int frame = 0; frame < 200; frame++)
+    {
+        // Move the mouse around so that contents change between frames
+        io.DeltaTime = 1.0f / 60.0f;
+        io.AddMousePosEvent(400.0f + 300.0f * cosf(frame * 0.05f), 300.0f + 200.0f * sinf(frame * 0.07f));
+        io.AddMouseButtonEvent(0, (frame % 40) < 3);
+
+        ImGui_ImplStream_NewFrame();
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        ImGui::SetNextWindowPos(ImVec2(800, 50), ImGuiCond_Once);
+        ImGui::ShowMetricsWindow();
+        if (frame >= 100)
+            ImGui::GetForegroundDrawList()->AddText(ImVec2(10, 10), IM_COL32_WHITE, "Larger text loads new glyphs \xE2\x82\xAC\xC3\xA9", nullptr);
+        ImGui::Render();
+
+        packet.resize(0);
+        if (late_decoder == nullptr && frame >= 100 && HasPendingTextureUpdates(ImGui::GetDrawData()))
+        {
+            late_decoder = ImGui_ImplStream_CreateDecoder();
+            ImGui_ImplStream_RequestKeyFrame();
+        }
+        ImGui_ImplStream_EncodeDrawData(ImGui::GetDrawData(), &packet);
+
+        ImGui_ImplStream_Decoder* decoders[2] = { decoder, late_decoder };
+        for (ImGui_ImplStream_Decoder* dec : decoders)
+        {
+            if (dec == nullptr)
+                continue;
+            const int used = ImGui_ImplStream_DecodeFrame(dec, packet.Data, packet.Size);
+            if (used != packet.Size)
+            {
+                printf("frame %d: decode returned %d for a %d bytes packet\n", frame, used, packet.Size);
+                errors++;
+                continue;
+            }
+            ImDrawData* draw_data = ImGui_ImplStream_GetDrawData(dec);
+            ViewerUpdateTextures(draw_data);
+            errors += CompareDrawData(ImGui::GetDrawData(), draw_data);
+            (dec == decoder ? frames_checked : late_frames_checked)++;
+        }
+    }
+
+    if (late_decoder == nullptr)
+    {
+        printf("late decoder never joined: no frame uploaded new glyphs\n");
+        errors++;
+    }
+
+    // A corrupted packet must be rejected
+    packet[0] ^= 0xFF;
+    if (ImGui_ImplStream_DecodeFrame(decoder, packet.Data, packet.Size) != -1)
+    {
+        printf("corrupted packet was not rejected\n");
+        errors++;
+    }
+
+    const ImGui_ImplStream_Stats* stats = ImGui_ImplStream_GetStats();
+    printf("%d + %d frames checked, %d errors. Average %d bytes/frame.\n", frames_checked, late_frames_checked, errors, (int)(stats->TotalBytes / (ImU64)stats->TotalFrames));
+
+    ImGui_ImplStream_DestroyDecoder(decoder);
+    ImGui_ImplStream_DestroyDecoder(late_decoder);
+    ImGui_ImplStream_Shutdown();
+    ImGui::DestroyContext();
+    return errors == 0 ? 0 : 1;
+}
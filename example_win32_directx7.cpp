@@ -20,6 +20,7 @@ static IDirectDrawSurface7* g_pPrimary = nullptr;   // Primary surface (front bu
 static IDirectDrawClipper* g_pClipper = nullptr;
 static IDirectDrawSurface7* g_pRenderTarget = nullptr;   // Offscreen render target with DDSCAPS_3DDEVICE
 static UINT                 g_ResizeWidth = 0, g_ResizeHeight = 0; // queued resize
+static bool                 g_InputReceived = false; // input message received since the last UI update
 
 // Forward declarations
 static bool CreateDeviceD3D7(HWND hWnd, UINT w, UINT h);
@@ -28,6 +29,7 @@ static bool CreateRenderTarget(UINT w, UINT h);
 static void DestroyRenderTarget();
 static bool ResetDevice(UINT w, UINT h);
 static void PresentToPrimary(HWND hWnd);
+static double GetTimeInSeconds();
 LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 // Main code
@@ -78,6 +80,23 @@ WNDCLASSEX wc = { sizeof(WNDCLASSEX), CS_CLASSDC, WndProc, 0L, 0L,
     bool  show_another_window = false;
     ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 
+    // UI update rate, decoupled from the present rate.
+    // Between UI updates, the last frame is presented again with ImGui_ImplDX7_RenderLastDrawData(), without calling NewFrame()/Render().
+    // Input received in between is queued by the Win32 backend and processed by the next NewFrame().
+    // In 'On input' mode, a few more updates follow input so the UI can settle (e.g. windows appearing); timers (tooltips, text cursor) wait for input.
+    enum UiUpdateMode { UiUpdateMode_EveryFrame, UiUpdateMode_60Hz, UiUpdateMode_30Hz, UiUpdateMode_OnInput };
+    int    ui_update_mode = UiUpdateMode_EveryFrame;
+    const int ui_settle_frames = 3;
+    int    ui_settle_frames_left = 0;
+    bool   ui_force_update = true;      // No frame to present yet
+    double ui_last_update_time = 0.0;
+
+    // Statistics, measured over one second.
+    double stats_start_time = GetTimeInSeconds();
+    int    stats_updates = 0, stats_presents = 0;
+    double stats_ui_time = 0.0;
+    float  updates_per_sec = 0.0f, presents_per_sec = 0.0f, ui_ms_per_sec = 0.0f, ui_ms_per_update = 0.0f;
+
     // Main loop
     bool done = false;
     while (!done)
@@ -98,47 +117,70 @@ WNDCLASSEX wc = { sizeof(WNDCLASSEX), CS_CLASSDC, WndProc, 0L, 0L,
         {
             ResetDevice(g_ResizeWidth, g_ResizeHeight);
             g_ResizeWidth = g_ResizeHeight = 0;
+            ui_force_update = true; // Textures were recreated
         }
 
-        // Start the Dear ImGui frame
-        ImGui_ImplWin32_NewFrame();
-        ImGui_ImplDX7_NewFrame();
-        ImGui::NewFrame();
-
-        // Demo UI
-        if (show_demo_window)
-            ImGui::ShowDemoWindow(&show_demo_window);
-
+        // Update the UI, or present the last frame again
+        const double time = GetTimeInSeconds();
+        bool update_ui = ui_force_update;
+        switch (ui_update_mode)
         {
-            static float f = 0.0f;
-            static int counter = 0;
-
-            ImGui::Begin("Hello, DX7!");
-            ImGui::Text("This is some useful text.");
-            ImGui::Checkbox("Demo Window", &show_demo_window);
-            ImGui::Checkbox("Another Window", &show_another_window);
-            ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
-            ImGui::ColorEdit3("clear color", (float*)&clear_color);
-            if (ImGui::Button("Button")) counter++;
-            ImGui::SameLine();
-            ImGui::Text("counter = %d", counter);
-            ImGui::Text("Application average %.3f ms/frame (%.1f FPS)",
-                1000.0f / io.Framerate, io.Framerate);
-            ImGui::End();
+        case UiUpdateMode_EveryFrame: update_ui = true; break;
+        case UiUpdateMode_60Hz:       update_ui |= (time - ui_last_update_time >= 1.0 / 60.0); break;
+        case UiUpdateMode_30Hz:       update_ui |= (time - ui_last_update_time >= 1.0 / 30.0); break;
+        case UiUpdateMode_OnInput:    update_ui |= (g_InputReceived || ui_settle_frames_left > 0); break;
         }
-
-        if (show_another_window)
+        if (update_ui)
         {
-            ImGui::Begin("Another Window", &show_another_window);
-            ImGui::Text("Hello from another window!");
-            if (ImGui::Button("Close Me"))
-                show_another_window = false;
-            ImGui::End();
+            ui_settle_frames_left = g_InputReceived ? ui_settle_frames : (ui_settle_frames_left > 0 ? ui_settle_frames_left - 1 : 0);
+            ui_force_update = g_InputReceived = false;
+            ui_last_update_time = time;
+
+            // Start the Dear ImGui frame
+            ImGui_ImplWin32_NewFrame();
+            ImGui_ImplDX7_NewFrame();
+            ImGui::NewFrame();
+
+            // Demo UI
+            if (show_demo_window)
+                ImGui::ShowDemoWindow(&show_demo_window);
+
+            {
+                static float f = 0.0f;
+                static int counter = 0;
+
+                ImGui::Begin("Hello, DX7!");
+                ImGui::Text("This is some useful text.");
+                ImGui::Checkbox("Demo Window", &show_demo_window);
+                ImGui::Checkbox("Another Window", &show_another_window);
+                ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+                ImGui::ColorEdit3("clear color", (float*)&clear_color);
+                if (ImGui::Button("Button")) counter++;
+                ImGui::SameLine();
+                ImGui::Text("counter = %d", counter);
+                ImGui::Text("Application average %.3f ms/frame (%.1f FPS)",
+                    1000.0f / io.Framerate, io.Framerate);
+                ImGui::Combo("UI update rate", &ui_update_mode, "Every frame\0" "60 Hz\0" "30 Hz\0" "On input\0");
+                ImGui::Text("UI updates: %.1f/s, presents: %.1f/s", updates_per_sec, presents_per_sec);
+                ImGui::Text("UI CPU time: %.3f ms/update, %.2f ms/s", ui_ms_per_update, ui_ms_per_sec);
+                ImGui::End();
+            }
+
+            if (show_another_window)
+            {
+                ImGui::Begin("Another Window", &show_another_window);
+                ImGui::Text("Hello from another window!");
+                if (ImGui::Button("Close Me"))
+                    show_another_window = false;
+                ImGui::End();
+            }
+
+            // Render
+            ImGui::Render();
+            stats_ui_time += GetTimeInSeconds() - time;
+            stats_updates++;
         }
 
-        // Render
-        ImGui::EndFrame();
-
         // Clear render target (Direct3D7 style)
         // We just draw a big colored quad by clearing via color fills using Blt with COLORFILL on the render target.
         // Simpler: just draw nothing and let ImGui overwrite; but to mimic DX9 sample clear, do a color fill:
@@ -155,14 +197,29 @@ WNDCLASSEX wc = { sizeof(WNDCLASSEX), CS_CLASSDC, WndProc, 0L, 0L,
         {
             g_pD3DDevice->BeginScene();
 
-            ImGui::Render();
-            ImGui_ImplDX7_RenderDrawData(ImGui::GetDrawData());
+            if (update_ui)
+                ImGui_ImplDX7_RenderDrawData(ImGui::GetDrawData());
+            else
+                ImGui_ImplDX7_RenderLastDrawData();
 
             g_pD3DDevice->EndScene();
         }
 
         // Present
         PresentToPrimary(hwnd);
+        stats_presents++;
+        if (time - stats_start_time >= 1.0)
+        {
+            const float stats_duration = (float)(time - stats_start_time);
+            updates_per_sec = stats_updates / stats_duration;
+            presents_per_sec = stats_presents / stats_duration;
+            ui_ms_per_sec = (float)(stats_ui_time * 1000.0) / stats_duration;
+            ui_ms_per_update = stats_updates > 0 ? (float)(stats_ui_time * 1000.0) / stats_updates : 0.0f;
+            stats_start_time = time;
+            stats_updates = stats_presents = 0;
+            stats_ui_time = 0.0;
+        }
+
         // Small nap helps old blitters behave nicely
         Sleep(1);
     }
@@ -355,12 +412,26 @@ static void PresentToPrimary(HWND hWnd)
     g_pPrimary->Blt(&dst, g_pRenderTarget, &src, DDBLT_WAIT, nullptr);
 }
 
+static double GetTimeInSeconds()
+{
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+}
+
 // Win32 message handler -------------------------------------------------------
 
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
 LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
+    if ((msg >= WM_MOUSEFIRST && msg <= WM_MOUSELAST) || (msg >= WM_KEYFIRST && msg <= WM_KEYLAST) ||
+        msg == WM_MOUSELEAVE || msg == WM_SETFOCUS || msg == WM_KILLFOCUS || msg == WM_INPUTLANGCHANGE)
+        g_InputReceived = true;
+
     if (ImGui_ImplWin32_WndProcHandler(hWnd, msg, wParam, lParam))
         return true;
 